@@ -0,0 +1,316 @@
+#ifndef FT_BTREE_MAP_HPP
+#define FT_BTREE_MAP_HPP 1
+
+#include <memory> // std::allocator
+#include <functional> // std::less
+#include <utility> // std::move
+
+#include "ft_pair.hpp"
+#include "btree.hpp"
+#include "ft_reverse_iterator.hpp"
+#include "ft_lexicographical_compare.hpp"
+#include "ft_type_traits.hpp"
+
+namespace ft {
+
+/// @brief Sorted associative container of unique keys, as `ft::map`, stored in
+///        a B-tree: each node packs many sorted elements into a few cache
+///        lines, so lookups and in order scans miss the cache far less.
+/// @note Unlike `ft::map`, inserting or erasing invalidates every iterator,
+///       since elements move between nodes.
+/// @note `Allocator` is rebound to the btree nodes: values and nodes all
+///       come from it.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<pair<typename ft::add_const<Key>::type, T> >
+> class btree_map
+{
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member types                                                      */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    typedef Key	                key_type;
+    typedef T	                mapped_type;
+    typedef pair<Key const, T>	value_type;
+    typedef Compare	            key_compare;
+    typedef Allocator           allocator_type;
+    typedef size_t              size_type;
+    typedef ptrdiff_t           difference_type;
+    typedef value_type &        reference;
+    typedef value_type const &  const_reference;
+    typedef value_type *        pointer;
+    typedef value_type const *  const_pointer;
+
+    private:
+
+    typedef btree<Key, value_type, btree_select_first<value_type>, Compare,
+                  Allocator>                            btree_type;
+
+    public:
+
+    typedef typename btree_type::iterator               iterator;
+    typedef typename btree_type::const_iterator         const_iterator;
+
+    typedef ft::reverse_iterator<iterator>              reverse_iterator;
+    typedef ft::reverse_iterator<const_iterator>        const_reverse_iterator;
+
+    class value_compare
+    {
+        friend class btree_map;
+
+        protected:
+
+        Compare comp;
+        value_compare (Compare c) : comp(c) { }
+
+        public:
+
+        typedef bool        result_type;
+        typedef value_type  first_argument_type;
+        typedef value_type  second_argument_type;
+
+        bool operator () (value_type const & a, value_type const & b) const
+        { return comp(a.first, b.first); }
+    };
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Internal data                                                     */
+    /*                                                                        */
+    /**************************************************************************/
+
+    private:
+
+    btree_type      _tree;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member functions                                                  */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    /****** Constructors ******************************************************/
+
+    /// @brief Constructor by default (1)
+    explicit btree_map (key_compare const & comp = key_compare(),
+                        Allocator const & alloc = Allocator())
+    : _tree(comp, alloc) { }
+
+    /// @brief Constructor by range (2)
+    template <class InputIterator>
+    btree_map (InputIterator first, InputIterator last,
+        key_compare const & comp = key_compare(),
+        Allocator const & alloc = Allocator(),
+        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    : _tree(comp, alloc) { insert(first, last); }
+
+    /// @brief Constructor by copy (3)
+    btree_map (btree_map const & m)
+    : _tree(m._tree) { }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (4)
+    btree_map (btree_map && m)
+    : _tree(std::move(m._tree)) { }
+#endif
+
+    /****** Destructor ********************************************************/
+
+    ~btree_map () { }
+
+    /****** Element access ****************************************************/
+
+    mapped_type & operator[] (key_type const & key)
+    { return _tree.insert_unique(value_type(key, mapped_type())).first->second; }
+
+    /****** Capacity **********************************************************/
+
+    bool empty () const
+    { return _tree.empty(); }
+
+    size_type size () const
+    { return _tree.size(); }
+
+    size_type max_size () const
+    { return _tree.max_size(); }
+
+    /****** Modifiers *********************************************************/
+
+    /// @brief Insert single element (1)
+    pair<iterator, bool> insert (value_type const & val)
+    { return _tree.insert_unique(val); }
+
+    /// @brief Insert with hint (2)
+    /// @note Only end() is used as a hint, to append sorted input in O(1)
+    iterator insert (iterator position, value_type const & val)
+    { return _tree.insert_unique(position, val); }
+
+    /// @brief Insert by iterator range (3)
+    template <class InputIterator>
+    void insert (InputIterator first, InputIterator last,
+    typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    { _tree.insert_range(first, last); }
+
+    /// @brief erase by iterator position (1)
+    void erase (iterator position)
+    { _tree.erase(position); }
+
+    /// @brief erase by key (2)
+    /// @return 1 if `key` was found and erased, 0 otherwise
+    size_type erase (key_type const & key)
+    { return _tree.erase(key); }
+
+    /// @brief erase by iterator range (3)
+    void erase (iterator first, iterator last)
+    { _tree.erase(first, last); }
+
+    void swap (btree_map & m)
+    { _tree.swap(m._tree); }
+
+    void clear ()
+    { _tree.clear(); }
+
+    /****** Observers *********************************************************/
+
+    key_compare key_comp () const
+    { return _tree.key_comp(); }
+
+    value_compare value_comp () const
+    { return value_compare(_tree.key_comp()); }
+
+    /****** Iterators *********************************************************/
+
+    iterator begin ()
+    { return _tree.begin(); }
+
+    const_iterator begin () const
+    { return _tree.begin(); }
+
+    iterator end ()
+    { return _tree.end(); }
+
+    const_iterator end () const
+    { return _tree.end(); }
+
+    reverse_iterator rbegin ()
+    { return reverse_iterator(end()); }
+
+    const_reverse_iterator rbegin () const
+    { return const_reverse_iterator(end()); }
+
+    reverse_iterator rend ()
+    { return reverse_iterator(begin()); }
+
+    const_reverse_iterator rend () const
+    { return const_reverse_iterator(begin()); }
+
+    /****** Operations ********************************************************/
+
+    iterator find (key_type const & key)
+    { return _tree.find(key); }
+
+    const_iterator find (key_type const & key) const
+    { return _tree.find(key); }
+
+    size_type count (key_type const & key) const
+    { return find(key) == end() ? 0 : 1; }
+
+    iterator lower_bound (key_type const & key)
+    { return _tree.lower_bound(key); }
+
+    const_iterator lower_bound (key_type const & key) const
+    { return _tree.lower_bound(key); }
+
+    iterator upper_bound (key_type const & key)
+    { return _tree.upper_bound(key); }
+
+    const_iterator upper_bound (key_type const & key) const
+    { return _tree.upper_bound(key); }
+
+    pair<iterator, iterator>
+    equal_range (key_type const & key)
+    { return pair<iterator, iterator>(lower_bound(key), upper_bound(key)); }
+
+    pair<const_iterator, const_iterator>
+    equal_range (key_type const & key) const
+    {
+        return pair<const_iterator, const_iterator>(lower_bound(key),
+                                                    upper_bound(key));
+    }
+
+    /****** Miscellaneous *****************************************************/
+
+    allocator_type get_allocator () const
+    { return allocator_type(_tree.get_allocator()); }
+
+    btree_map & operator= (btree_map const & m)
+    { _tree = m._tree; return *this; }
+
+#if __cplusplus >= 201103L
+    btree_map & operator= (btree_map && m)
+    { _tree = std::move(m._tree); return *this; }
+#endif
+};
+
+/******************************************************************************/
+/*                                                                            */
+/*      Non member functions                                                  */
+/*                                                                            */
+/******************************************************************************/
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator== (btree_map<Key, T, Comp, Alloc> const & lhs,
+                 btree_map<Key, T, Comp, Alloc> const & rhs)
+{
+    typename btree_map<Key, T, Comp, Alloc>::const_iterator lit = lhs.begin();
+    typename btree_map<Key, T, Comp, Alloc>::const_iterator rit = rhs.begin();
+    typename btree_map<Key, T, Comp, Alloc>::const_iterator lite = lhs.end();
+    typename btree_map<Key, T, Comp, Alloc>::const_iterator rite = rhs.end();
+
+    if (lhs.size() != rhs.size())
+        return false;
+    for (; lit != lite && rit != rite && *lit == *rit; lit++, rit++);
+    return (lit == lite && rit == rite);
+}
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator!= (btree_map<Key, T, Comp, Alloc> const & lhs,
+                 btree_map<Key, T, Comp, Alloc> const & rhs)
+{ return !(lhs == rhs); }
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+void swap (btree_map<Key, T, Comp, Alloc> & lhs,
+           btree_map<Key, T, Comp, Alloc> & rhs)
+{ lhs.swap(rhs); }
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator< (btree_map<Key, T, Comp, Alloc> const & lhs,
+                btree_map<Key, T, Comp, Alloc> const & rhs)
+{
+    return
+    lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator> (btree_map<Key, T, Comp, Alloc> const & lhs,
+                btree_map<Key, T, Comp, Alloc> const & rhs)
+{ return rhs < lhs; }
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator<= (btree_map<Key, T, Comp, Alloc> const & lhs,
+                 btree_map<Key, T, Comp, Alloc> const & rhs)
+{ return !(rhs < lhs); }
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator>= (btree_map<Key, T, Comp, Alloc> const & lhs,
+                 btree_map<Key, T, Comp, Alloc> const & rhs)
+{ return !(lhs < rhs); }
+
+} // namespace
+
+#endif /* FT_BTREE_MAP_HPP */
@@ -0,0 +1,259 @@
+#ifndef FT_BTREE_SET_HPP
+#define FT_BTREE_SET_HPP 1
+
+#include <memory> // std::allocator
+#include <functional> // std::less
+#include <utility> // std::move
+
+#include "ft_pair.hpp"
+#include "btree.hpp"
+#include "ft_reverse_iterator.hpp"
+#include "ft_lexicographical_compare.hpp"
+#include "ft_type_traits.hpp"
+
+namespace ft {
+
+/// @brief Sorted set of unique keys stored in a B-tree, see `btree_map`
+/// @note Elements are keys, so iterators are constant ones.
+/// @note `Allocator` is rebound to the btree nodes: values and nodes all
+///       come from it.
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>
+> class btree_set
+{
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member types                                                      */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    typedef Key	                key_type;
+    typedef Key	                value_type;
+    typedef Compare	            key_compare;
+    typedef Compare	            value_compare;
+    typedef Allocator           allocator_type;
+    typedef size_t              size_type;
+    typedef ptrdiff_t           difference_type;
+    typedef value_type &        reference;
+    typedef value_type const &  const_reference;
+    typedef value_type *        pointer;
+    typedef value_type const *  const_pointer;
+
+    private:
+
+    typedef btree<Key, Key, btree_identity<Key>, Compare, Allocator>
+                                                        btree_type;
+
+    public:
+
+    typedef typename btree_type::const_iterator         iterator;
+    typedef typename btree_type::const_iterator         const_iterator;
+
+    typedef ft::reverse_iterator<iterator>              reverse_iterator;
+    typedef ft::reverse_iterator<const_iterator>        const_reverse_iterator;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Internal data                                                     */
+    /*                                                                        */
+    /**************************************************************************/
+
+    private:
+
+    btree_type      _tree;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member functions                                                  */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    /****** Constructors ******************************************************/
+
+    /// @brief Constructor by default (1)
+    explicit btree_set (key_compare const & comp = key_compare(),
+                        Allocator const & alloc = Allocator())
+    : _tree(comp, alloc) { }
+
+    /// @brief Constructor by range (2)
+    template <class InputIterator>
+    btree_set (InputIterator first, InputIterator last,
+        key_compare const & comp = key_compare(),
+        Allocator const & alloc = Allocator(),
+        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    : _tree(comp, alloc) { insert(first, last); }
+
+    /// @brief Constructor by copy (3)
+    btree_set (btree_set const & s)
+    : _tree(s._tree) { }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (4)
+    btree_set (btree_set && s)
+    : _tree(std::move(s._tree)) { }
+#endif
+
+    /****** Destructor ********************************************************/
+
+    ~btree_set () { }
+
+    /****** Capacity **********************************************************/
+
+    bool empty () const
+    { return _tree.empty(); }
+
+    size_type size () const
+    { return _tree.size(); }
+
+    size_type max_size () const
+    { return _tree.max_size(); }
+
+    /****** Modifiers *********************************************************/
+
+    /// @brief Insert single element (1)
+    pair<iterator, bool> insert (value_type const & val)
+    { return _tree.insert_unique(val); }
+
+    /// @brief Insert with hint (2)
+    /// @note Only end() is used as a hint, to append sorted input in O(1)
+    iterator insert (iterator position, value_type const & val)
+    { return _tree.insert_unique(position, val); }
+
+    /// @brief Insert by iterator range (3)
+    template <class InputIterator>
+    void insert (InputIterator first, InputIterator last,
+    typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    { _tree.insert_range(first, last); }
+
+    /// @brief erase by iterator position (1)
+    void erase (iterator position)
+    { _tree.erase(position); }
+
+    /// @brief erase by key (2)
+    /// @return 1 if `key` was found and erased, 0 otherwise
+    size_type erase (key_type const & key)
+    { return _tree.erase(key); }
+
+    /// @brief erase by iterator range (3)
+    void erase (iterator first, iterator last)
+    { _tree.erase(first, last); }
+
+    void swap (btree_set & s)
+    { _tree.swap(s._tree); }
+
+    void clear ()
+    { _tree.clear(); }
+
+    /****** Observers *********************************************************/
+
+    key_compare key_comp () const
+    { return _tree.key_comp(); }
+
+    value_compare value_comp () const
+    { return _tree.key_comp(); }
+
+    /****** Iterators *********************************************************/
+
+    iterator begin () const
+    { return _tree.begin(); }
+
+    iterator end () const
+    { return _tree.end(); }
+
+    reverse_iterator rbegin () const
+    { return reverse_iterator(end()); }
+
+    reverse_iterator rend () const
+    { return reverse_iterator(begin()); }
+
+    /****** Operations ********************************************************/
+
+    iterator find (key_type const & key) const
+    { return _tree.find(key); }
+
+    size_type count (key_type const & key) const
+    { return find(key) == end() ? 0 : 1; }
+
+    iterator lower_bound (key_type const & key) const
+    { return _tree.lower_bound(key); }
+
+    iterator upper_bound (key_type const & key) const
+    { return _tree.upper_bound(key); }
+
+    pair<iterator, iterator> equal_range (key_type const & key) const
+    { return pair<iterator, iterator>(lower_bound(key), upper_bound(key)); }
+
+    /****** Miscellaneous *****************************************************/
+
+    allocator_type get_allocator () const
+    { return allocator_type(_tree.get_allocator()); }
+
+    btree_set & operator= (btree_set const & s)
+    { _tree = s._tree; return *this; }
+
+#if __cplusplus >= 201103L
+    btree_set & operator= (btree_set && s)
+    { _tree = std::move(s._tree); return *this; }
+#endif
+};
+
+/******************************************************************************/
+/*                                                                            */
+/*      Non member functions                                                  */
+/*                                                                            */
+/******************************************************************************/
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator== (btree_set<Key, Comp, Alloc> const & lhs,
+                 btree_set<Key, Comp, Alloc> const & rhs)
+{
+    typename btree_set<Key, Comp, Alloc>::const_iterator lit = lhs.begin();
+    typename btree_set<Key, Comp, Alloc>::const_iterator rit = rhs.begin();
+    typename btree_set<Key, Comp, Alloc>::const_iterator lite = lhs.end();
+    typename btree_set<Key, Comp, Alloc>::const_iterator rite = rhs.end();
+
+    if (lhs.size() != rhs.size())
+        return false;
+    for (; lit != lite && rit != rite && *lit == *rit; lit++, rit++);
+    return (lit == lite && rit == rite);
+}
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator!= (btree_set<Key, Comp, Alloc> const & lhs,
+                 btree_set<Key, Comp, Alloc> const & rhs)
+{ return !(lhs == rhs); }
+
+template <typename Key, typename Comp, typename Alloc>
+void swap (btree_set<Key, Comp, Alloc> & lhs, btree_set<Key, Comp, Alloc> & rhs)
+{ lhs.swap(rhs); }
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator< (btree_set<Key, Comp, Alloc> const & lhs,
+                btree_set<Key, Comp, Alloc> const & rhs)
+{
+    return
+    lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator> (btree_set<Key, Comp, Alloc> const & lhs,
+                btree_set<Key, Comp, Alloc> const & rhs)
+{ return rhs < lhs; }
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator<= (btree_set<Key, Comp, Alloc> const & lhs,
+                 btree_set<Key, Comp, Alloc> const & rhs)
+{ return !(rhs < lhs); }
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator>= (btree_set<Key, Comp, Alloc> const & lhs,
+                 btree_set<Key, Comp, Alloc> const & rhs)
+{ return !(lhs < rhs); }
+
+} // namespace
+
+#endif /* FT_BTREE_SET_HPP */
@@ -0,0 +1,450 @@
+#ifndef FT_FLAT_MAP_HPP
+#define FT_FLAT_MAP_HPP 1
+
+#include <memory> // std::allocator
+#include <functional> // std::less
+#include <algorithm> // std::stable_sort
+#include <utility> // std::move
+
+#include "ft_pair.hpp"
+#include "ft_vector.hpp"
+#include "ft_type_traits.hpp"
+#include "ft_lexicographical_compare.hpp"
+
+namespace ft {
+
+/// @brief Sorted associative container of unique keys, as `ft::map`, stored
+///        as a sorted `ft::vector` of pairs
+/// @note Lookups are binary searches over contiguous memory, and elements
+///       cost their own size only. Single inserts and erases shift the
+///       elements after them, in O(n): fill with the range insert, which
+///       sorts the new elements and merges them in a single pass.
+/// @note As for other flat maps, `value_type` is `pair<Key, T>` with a
+///       mutable key, since elements are assigned when shifted. Changing a
+///       key through an iterator breaks the map order. Inserting or erasing
+///       invalidates iterators past the position, or all on reallocation.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<pair<Key, T> >
+> class flat_map
+{
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member types                                                      */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    typedef Key	                key_type;
+    typedef T	                mapped_type;
+    typedef pair<Key, T>	    value_type;
+    typedef Compare	            key_compare;
+    typedef Allocator           allocator_type;
+    typedef size_t              size_type;
+    typedef ptrdiff_t           difference_type;
+    typedef value_type &        reference;
+    typedef value_type const &  const_reference;
+    typedef value_type *        pointer;
+    typedef value_type const *  const_pointer;
+
+    private:
+
+    typedef ft::vector<value_type, Allocator>           vector_type;
+
+    public:
+
+    typedef typename vector_type::iterator              iterator;
+    typedef typename vector_type::const_iterator        const_iterator;
+    typedef typename vector_type::reverse_iterator      reverse_iterator;
+    typedef typename vector_type::const_reverse_iterator const_reverse_iterator;
+
+    class value_compare
+    {
+        friend class flat_map;
+
+        protected:
+
+        Compare comp;
+        value_compare (Compare c) : comp(c) { }
+
+        public:
+
+        typedef bool        result_type;
+        typedef value_type  first_argument_type;
+        typedef value_type  second_argument_type;
+
+        bool operator () (value_type const & a, value_type const & b) const
+        { return comp(a.first, b.first); }
+    };
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Internal data                                                     */
+    /*                                                                        */
+    /**************************************************************************/
+
+    private:
+
+    key_compare     _comp;
+    vector_type     _data;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member functions                                                  */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    /****** Constructors ******************************************************/
+
+    /// @brief Constructor by default (1)
+    explicit flat_map (key_compare const & comp = key_compare(),
+                       Allocator const & alloc = Allocator())
+    : _comp(comp), _data(alloc) { }
+
+    /// @brief Constructor by range (2)
+    template <class InputIterator>
+    flat_map (InputIterator first, InputIterator last,
+        key_compare const & comp = key_compare(),
+        Allocator const & alloc = Allocator(),
+        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    : _comp(comp), _data(alloc) { insert(first, last); }
+
+    /// @brief Constructor by copy (3)
+    flat_map (flat_map const & m)
+    : _comp(m._comp), _data(m._data) { }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (4)
+    flat_map (flat_map && m)
+    : _comp(m._comp), _data(m.get_allocator())
+    { _data.swap(m._data); }
+#endif
+
+    /****** Destructor ********************************************************/
+
+    ~flat_map () { }
+
+    /****** Element access ****************************************************/
+
+    mapped_type & operator[] (key_type const & key)
+    {
+        size_type i = _lower_index(key);
+
+        if (i == size() || _comp(key, _data[i].first))
+            _data.insert(_at(i), value_type(key, mapped_type()));
+        return _data[i].second;
+    }
+
+    /****** Capacity **********************************************************/
+
+    bool empty () const
+    { return _data.empty(); }
+
+    size_type size () const
+    { return _data.size(); }
+
+    size_type max_size () const
+    { return _data.max_size(); }
+
+    size_type capacity () const
+    { return _data.capacity(); }
+
+    void reserve (size_type n)
+    { _data.reserve(n); }
+
+    /****** Modifiers *********************************************************/
+
+    /// @brief Insert single element (1)
+    pair<iterator, bool> insert (value_type const & val)
+    {
+        size_type i = _lower_index(val.first);
+
+        if (i < size() && !_comp(val.first, _data[i].first))
+            return pair<iterator, bool>(_at(i), false);
+        return pair<iterator, bool>(_data.insert(_at(i), val), true);
+    }
+
+    /// @brief Insert with hint (2)
+    /// @note The hint is used when `val` goes right before it, as for sorted
+    ///       input inserted at end()
+    iterator insert (iterator position, value_type const & val)
+    {
+        if ((position == begin() || _comp((position - 1)->first, val.first))
+            && (position == end() || _comp(val.first, position->first)))
+            return _data.insert(position, val);
+        return insert(val).first;
+    }
+
+    /// @brief Insert by iterator range (3)
+    /// @note Sorts the new elements, drops those whose key is already there
+    ///       (the first one of equal keys is kept, as by single inserts),
+    ///       then merges from the back in one pass: O(n + m log m) instead of
+    ///       O(n m) for m single inserts.
+    template <class InputIterator>
+    void insert (InputIterator first, InputIterator last,
+    typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    {
+        if (first == last)
+            return;
+
+        vector_type add(first, last, _data.get_allocator());
+        size_type n = 0;
+        size_type old = size();
+
+        std::stable_sort(&add[0], &add[0] + add.size(), value_comp());
+
+        // keep new keys only, compacting them at the front of `add`
+        for (size_type i = 0, j = 0; i < add.size(); i++)
+        {
+            if (n > 0 && !_comp(add[n - 1].first, add[i].first))
+                continue;
+            while (j < old && _comp(_data[j].first, add[i].first))
+                j++;
+            if (j < old && !_comp(add[i].first, _data[j].first))
+                continue;
+            add[n++] = add[i];
+        }
+
+        // merge both sorted ranges from the back, into the grown vector
+        if (size() + n > capacity())
+            _data.reserve(size() + n);
+        _data.insert(_data.end(), n, value_type());
+        for (size_type i = old, d = old + n; n > 0; )
+        {
+            if (i > 0 && _comp(add[n - 1].first, _data[i - 1].first))
+                _data[--d] = _data[--i];
+            else
+                _data[--d] = add[--n];
+        }
+    }
+
+    /// @brief erase by iterator position (1)
+    void erase (iterator position)
+    { _data.erase(position); }
+
+    /// @brief erase by key (2)
+    /// @return 1 if `key` was found and erased, 0 otherwise
+    size_type erase (key_type const & key)
+    {
+        iterator it = find(key);
+
+        if (it == end())
+            return 0;
+        _data.erase(it);
+        return 1;
+    }
+
+    /// @brief erase by iterator range (3)
+    void erase (iterator first, iterator last)
+    { _data.erase(first, last); }
+
+    void swap (flat_map & m)
+    {
+        key_compare comp = _comp;
+
+        _comp = m._comp;
+        m._comp = comp;
+        _data.swap(m._data);
+    }
+
+    void clear ()
+    { _data.clear(); }
+
+    /****** Observers *********************************************************/
+
+    key_compare key_comp () const
+    { return _comp; }
+
+    value_compare value_comp () const
+    { return value_compare(_comp); }
+
+    /****** Iterators *********************************************************/
+
+    iterator begin ()
+    { return _data.begin(); }
+
+    const_iterator begin () const
+    { return _data.begin(); }
+
+    iterator end ()
+    { return _data.end(); }
+
+    const_iterator end () const
+    { return _data.end(); }
+
+    reverse_iterator rbegin ()
+    { return _data.rbegin(); }
+
+    const_reverse_iterator rbegin () const
+    { return _data.rbegin(); }
+
+    reverse_iterator rend ()
+    { return _data.rend(); }
+
+    const_reverse_iterator rend () const
+    { return _data.rend(); }
+
+    /****** Operations ********************************************************/
+
+    iterator find (key_type const & key)
+    {
+        size_type i = _lower_index(key);
+        return i < size() && !_comp(key, _data[i].first) ? _at(i) : end();
+    }
+
+    const_iterator find (key_type const & key) const
+    {
+        size_type i = _lower_index(key);
+        return i < size() && !_comp(key, _data[i].first) ? _at(i) : end();
+    }
+
+    size_type count (key_type const & key) const
+    { return find(key) == end() ? 0 : 1; }
+
+    iterator lower_bound (key_type const & key)
+    { return _at(_lower_index(key)); }
+
+    const_iterator lower_bound (key_type const & key) const
+    { return _at(_lower_index(key)); }
+
+    iterator upper_bound (key_type const & key)
+    { return _at(_upper_index(key)); }
+
+    const_iterator upper_bound (key_type const & key) const
+    { return _at(_upper_index(key)); }
+
+    pair<iterator, iterator>
+    equal_range (key_type const & key)
+    { return pair<iterator, iterator>(lower_bound(key), upper_bound(key)); }
+
+    pair<const_iterator, const_iterator>
+    equal_range (key_type const & key) const
+    {
+        return pair<const_iterator, const_iterator>(lower_bound(key),
+                                                    upper_bound(key));
+    }
+
+    /****** Miscellaneous *****************************************************/
+
+    allocator_type get_allocator () const
+    { return _data.get_allocator(); }
+
+    flat_map & operator= (flat_map const & m)
+    {
+        _comp = m._comp;
+        _data = m._data;
+        return *this;
+    }
+
+#if __cplusplus >= 201103L
+    flat_map & operator= (flat_map && m)
+    {
+        _comp = m._comp;
+        _data.clear();
+        _data.swap(m._data);
+        return *this;
+    }
+#endif
+
+    /****** Internals *********************************************************/
+
+    private:
+
+    iterator _at (size_type i)
+    { return _data.begin() + static_cast<difference_type>(i); }
+
+    const_iterator _at (size_type i) const
+    { return _data.begin() + static_cast<difference_type>(i); }
+
+    /// @return Index of the first element whose key is not less than `key`
+    size_type _lower_index (key_type const & key) const
+    {
+        size_type lo = 0;
+        size_type hi = size();
+
+        while (lo < hi)
+        {
+            size_type mid = lo + (hi - lo) / 2;
+            if (_comp(_data[mid].first, key))
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    /// @return Index of the first element whose key is greater than `key`
+    size_type _upper_index (key_type const & key) const
+    {
+        size_type lo = 0;
+        size_type hi = size();
+
+        while (lo < hi)
+        {
+            size_type mid = lo + (hi - lo) / 2;
+            if (_comp(key, _data[mid].first))
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+        return lo;
+    }
+};
+
+/******************************************************************************/
+/*                                                                            */
+/*      Non member functions                                                  */
+/*                                                                            */
+/******************************************************************************/
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator== (flat_map<Key, T, Comp, Alloc> const & lhs,
+                 flat_map<Key, T, Comp, Alloc> const & rhs)
+{
+    typename flat_map<Key, T, Comp, Alloc>::const_iterator lit = lhs.begin();
+    typename flat_map<Key, T, Comp, Alloc>::const_iterator rit = rhs.begin();
+
+    if (lhs.size() != rhs.size())
+        return false;
+    for (; lit != lhs.end() && *lit == *rit; lit++, rit++);
+    return lit == lhs.end();
+}
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator!= (flat_map<Key, T, Comp, Alloc> const & lhs,
+                 flat_map<Key, T, Comp, Alloc> const & rhs)
+{ return !(lhs == rhs); }
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+void swap (flat_map<Key, T, Comp, Alloc> & lhs,
+           flat_map<Key, T, Comp, Alloc> & rhs)
+{ lhs.swap(rhs); }
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator< (flat_map<Key, T, Comp, Alloc> const & lhs,
+                flat_map<Key, T, Comp, Alloc> const & rhs)
+{
+    return
+    lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator> (flat_map<Key, T, Comp, Alloc> const & lhs,
+                flat_map<Key, T, Comp, Alloc> const & rhs)
+{ return rhs < lhs; }
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator<= (flat_map<Key, T, Comp, Alloc> const & lhs,
+                 flat_map<Key, T, Comp, Alloc> const & rhs)
+{ return !(rhs < lhs); }
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator>= (flat_map<Key, T, Comp, Alloc> const & lhs,
+                 flat_map<Key, T, Comp, Alloc> const & rhs)
+{ return !(lhs < rhs); }
+
+} // namespace
+
+#endif /* FT_FLAT_MAP_HPP */
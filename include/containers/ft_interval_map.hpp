@@ -0,0 +1,405 @@
+#ifndef FT_INTERVAL_MAP_HPP
+#define FT_INTERVAL_MAP_HPP 1
+
+#include <memory> // std::allocator
+#include <functional> // std::less
+#include <utility> // std::move
+
+#include "ft_pair.hpp"
+#include "ft_type_traits.hpp"
+#include "rb_tree.hpp"
+#include "ft_rb_tree_iterator.hpp"
+#include "ft_reverse_iterator.hpp"
+
+namespace ft {
+
+/**
+ *  @brief rb_tree augmentation keeping the greatest high endpoint of a subtree
+ *  @note Keys are (interval, mapped value) pairs, the interval being a
+ *        (low, high) pair. `empty` marks the summary of an empty subtree.
+ */
+template <typename Point, typename Compare = std::less<Point> >
+struct rb_max_endpoint
+{
+    static const bool enabled = true;
+    static const bool reads_mapped = false;
+
+    typedef Point summary_type;
+
+    Point high;
+    bool empty;
+
+    rb_max_endpoint () : high(), empty(true) { }
+
+    template <typename Key>
+    void update (rb_max_endpoint const & left, rb_max_endpoint const & right,
+                 Key const & key)
+    {
+        Compare comp;
+
+        high = key.first.second;
+        if (!left.empty && comp(high, left.high))
+            high = left.high;
+        if (!right.empty && comp(high, right.high))
+            high = right.high;
+        empty = false;
+    }
+};
+
+/// @brief Map of closed intervals [low, high] of `Point` to `T`
+/// @note Intervals are ordered by low then high endpoint and are unique, as
+///       keys of a map. Every node also knows the greatest high endpoint of
+///       its subtree, so queries skip subtrees ending before the points they
+///       look for.
+/// @note `Allocator` is rebound to the rb_tree node type, which all nodes
+///       come from.
+template <typename Point, typename T, typename Compare = std::less<Point>,
+          typename Allocator = std::allocator<pair<pair<Point, Point> const, T> >
+> class interval_map
+{
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member types                                                      */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    class value_compare; // forward declaration
+
+    typedef Point                       point_type;
+    typedef pair<Point, Point>          interval_type;
+    typedef interval_type               key_type;
+    typedef T                           mapped_type;
+    typedef pair<interval_type const, T> value_type;
+    typedef Compare                     point_compare;
+    typedef Allocator                   allocator_type;
+    typedef size_t                      size_type;
+    typedef ptrdiff_t                   difference_type;
+    typedef value_type &                reference;
+    typedef value_type const &          const_reference;
+    typedef value_type *                pointer;
+    typedef value_type const *          const_pointer;
+
+    private:
+
+    typedef rb_max_endpoint<Point, Compare>                 augment_type;
+    typedef rb_tree<value_type, value_compare, augment_type, rb_unique_keys,
+                    rb_pointer_links, rb_heap_storage, Allocator> btree_type;
+    typedef typename btree_type::allocator_type             node_allocator_type;
+    typedef typename btree_type::value_type                 node_type;
+    typedef typename btree_type::value_type *               node_pointer;
+
+    public:
+
+    typedef rb_tree_iterator<node_type, value_type>         iterator;
+    typedef rb_tree_iterator<node_type, value_type const>   const_iterator;
+
+    typedef ft::reverse_iterator<iterator>                  reverse_iterator;
+    typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
+
+    /// @brief Orders intervals by low endpoint, then by high endpoint
+    class value_compare
+    {
+        protected:
+
+        Compare comp;
+
+        public:
+
+        value_compare () { }
+
+        typedef bool        result_type;
+        typedef value_type  first_argument_type;
+        typedef value_type  second_argument_type;
+
+        bool operator () (value_type const & a, value_type const & b) const
+        {
+            if (comp(a.first.first, b.first.first))
+                return true;
+            if (comp(b.first.first, a.first.first))
+                return false;
+            return comp(a.first.second, b.first.second);
+        }
+    };
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Internal data                                                     */
+    /*                                                                        */
+    /**************************************************************************/
+
+    private:
+
+    point_compare   _comp;
+    btree_type      _tree;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member functions                                                  */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    /****** Constructors ******************************************************/
+
+    /// @brief Constructor by default (1)
+    explicit interval_map (Allocator const & alloc = Allocator())
+    : _tree(node_allocator_type(alloc)) { }
+
+    /// @brief Constructor by range (2)
+    template <class InputIterator>
+    interval_map (InputIterator first, InputIterator last,
+        Allocator const & alloc = Allocator(),
+        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    : _tree(node_allocator_type(alloc))
+    { insert(first, last); }
+
+    /// @brief Constructor by copy (3)
+    interval_map (interval_map const & m)
+    : _tree(m._tree) { }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (4)
+    interval_map (interval_map && m)
+    : _tree(std::move(m._tree)) { }
+#endif
+
+    /****** Destructor ********************************************************/
+
+    ~interval_map () { }
+
+    /****** Capacity **********************************************************/
+
+    bool empty () const
+    { return _tree.empty(); }
+
+    size_type size () const
+    { return _tree.size(); }
+
+    size_type max_size () const
+    { return _tree.max_size(); }
+
+    /****** Modifiers *********************************************************/
+
+    /// @brief Insert single element (1)
+    /// @pre `val` interval low endpoint is not greater than its high one
+    pair<iterator, bool> insert (value_type const & val)
+    {
+        pair<node_pointer, bool> p = _tree.insert_unique(val);
+        return pair<iterator, bool>(iterator(p.first, _tree.sentinel()), p.second);
+    }
+
+    /// @brief Insert interval [low, high] mapped to `value` (2)
+    pair<iterator, bool> insert (point_type const & low, point_type const & high,
+                                 mapped_type const & value)
+    { return insert(value_type(interval_type(low, high), value)); }
+
+    /// @brief Insert by iterator range (3)
+    template <class InputIterator>
+    void insert (InputIterator first, InputIterator last,
+    typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    { _tree.insert_range(first, last); }
+
+    /// @brief erase by iterator position (1)
+    void erase (iterator position)
+    { _tree.erase(position.current_node()); }
+
+    /// @brief erase by interval (2)
+    /// @return 1 if `interval` was found and erased, 0 otherwise
+    size_type erase (interval_type const & interval)
+    { return _tree.erase(value_type(interval, mapped_type())); }
+
+    /// @brief erase by iterator range (3)
+    void erase (iterator first, iterator last)
+    { _tree.erase(first.current_node(), last.current_node()); }
+
+    void swap (interval_map & m)
+    { _tree.swap(m._tree); }
+
+    void clear ()
+    { _tree.clear(); }
+
+    /****** Iterators *********************************************************/
+
+    iterator begin ()
+    { return iterator(_tree.leftmost(), _tree.sentinel()); }
+
+    const_iterator begin () const
+    { return const_iterator(_tree.leftmost(), _tree.sentinel()); }
+
+    iterator end ()
+    { return iterator(_tree.sentinel(), _tree.sentinel()); }
+
+    const_iterator end () const
+    { return const_iterator(_tree.sentinel(), _tree.sentinel()); }
+
+    reverse_iterator rbegin ()
+    { return reverse_iterator(end()); }
+
+    const_reverse_iterator rbegin () const
+    { return const_reverse_iterator(end()); }
+
+    reverse_iterator rend ()
+    { return reverse_iterator(begin()); }
+
+    const_reverse_iterator rend () const
+    { return const_reverse_iterator(begin()); }
+
+    /****** Operations ********************************************************/
+
+    iterator find (interval_type const & interval)
+    {
+        node_pointer p = _tree.find(value_type(interval, mapped_type()));
+        return p ? iterator(p, _tree.sentinel()) : end();
+    }
+
+    const_iterator find (interval_type const & interval) const
+    {
+        node_pointer p = _tree.find(value_type(interval, mapped_type()));
+        return p ? const_iterator(p, _tree.sentinel()) : end();
+    }
+
+    size_type count (interval_type const & interval) const
+    { return find(interval) == end() ? 0 : 1; }
+
+    /****** Interval queries **************************************************/
+
+    /// @brief Write an iterator to every interval containing `x` to `out`,
+    ///        in order
+    /// @note As `overlap(x, x, out)`, with the same cost.
+    template <typename OutputIterator>
+    OutputIterator stab (point_type const & x, OutputIterator out)
+    { return overlap(x, x, out); }
+
+    template <typename OutputIterator>
+    OutputIterator stab (point_type const & x, OutputIterator out) const
+    { return overlap(x, x, out); }
+
+    /// @brief Write an iterator to every interval overlapping [lo, hi] to
+    ///        `out`, in order
+    /// @note Subtrees whose greatest high endpoint is less than `lo`, and
+    ///       right subtrees of nodes starting after `hi`, are never entered.
+    ///       Still, each of the k intervals reported may cost a descent
+    ///       through left subtrees that only partly overlap: O(min(n,
+    ///       k log n)) in the worst case, not the O(log n + k) of a
+    ///       structure dedicated to these queries.
+    template <typename OutputIterator>
+    OutputIterator overlap (point_type const & lo, point_type const & hi,
+                            OutputIterator out)
+    {
+        _overlap<iterator>(_tree.root(), lo, hi, out);
+        return out;
+    }
+
+    template <typename OutputIterator>
+    OutputIterator overlap (point_type const & lo, point_type const & hi,
+                            OutputIterator out) const
+    {
+        _overlap<const_iterator>(_tree.root(), lo, hi, out);
+        return out;
+    }
+
+    /// @return Some interval overlapping [lo, hi], or end, in O(log n)
+    /// @note Goes left whenever the left subtree reaches `lo`: if none of its
+    ///       intervals overlaps, none on the right does either.
+    iterator find_overlap (point_type const & lo, point_type const & hi)
+    { return iterator(_find_overlap(lo, hi), _tree.sentinel()); }
+
+    const_iterator find_overlap (point_type const & lo,
+                                 point_type const & hi) const
+    { return const_iterator(_find_overlap(lo, hi), _tree.sentinel()); }
+
+    /****** Miscellaneous *****************************************************/
+
+    allocator_type get_allocator () const
+    { return allocator_type(_tree.get_allocator()); }
+
+    interval_map & operator= (interval_map const & m)
+    { _tree = m._tree; return *this; }
+
+#if __cplusplus >= 201103L
+    interval_map & operator= (interval_map && m)
+    { _tree = std::move(m._tree); return *this; }
+#endif
+
+    /****** Internals *********************************************************/
+
+    private:
+
+    /// @return Whether interval of node `x` overlaps [lo, hi]
+    bool _overlaps (node_pointer x, point_type const & lo,
+                    point_type const & hi) const
+    {
+        return !_comp(hi, x->key.first.first)
+            && !_comp(x->key.first.second, lo);
+    }
+
+    template <typename Iterator, typename OutputIterator>
+    void _overlap (node_pointer x, point_type const & lo, point_type const & hi,
+                   OutputIterator & out) const
+    {
+        while (x != _tree.sentinel() && !_comp(x->high, lo))
+        {
+            _overlap<Iterator>(_tree.left(x), lo, hi, out);
+            if (_comp(hi, x->key.first.first))
+                return;
+            if (!_comp(x->key.first.second, lo))
+                *out++ = Iterator(x, _tree.sentinel());
+            x = _tree.right(x);
+        }
+    }
+
+    node_pointer _find_overlap (point_type const & lo,
+                                point_type const & hi) const
+    {
+        node_pointer x = _tree.root();
+
+        while (x != _tree.sentinel() && !_overlaps(x, lo, hi))
+        {
+            node_pointer l = _tree.left(x);
+
+            if (l != _tree.sentinel() && !_comp(l->high, lo))
+                x = l;
+            else
+                x = _tree.right(x);
+        }
+        return x;
+    }
+};
+
+/******************************************************************************/
+/*                                                                            */
+/*      Non member functions                                                  */
+/*                                                                            */
+/******************************************************************************/
+
+template <typename Point, typename T, typename Comp, typename Alloc>
+bool operator== (interval_map<Point, T, Comp, Alloc> const & lhs,
+                 interval_map<Point, T, Comp, Alloc> const & rhs)
+{
+    typename interval_map<Point, T, Comp, Alloc>::const_iterator lit = lhs.begin();
+    typename interval_map<Point, T, Comp, Alloc>::const_iterator rit = rhs.begin();
+    typename interval_map<Point, T, Comp, Alloc>::const_iterator lite = lhs.end();
+    typename interval_map<Point, T, Comp, Alloc>::const_iterator rite = rhs.end();
+
+    if (lhs.size() != rhs.size())
+        return false;
+    for (; lit != lite && rit != rite && *lit == *rit; lit++, rit++);
+    return (lit == lite && rit == rite);
+}
+
+template <typename Point, typename T, typename Comp, typename Alloc>
+bool operator!= (interval_map<Point, T, Comp, Alloc> const & lhs,
+                 interval_map<Point, T, Comp, Alloc> const & rhs)
+{ return !(lhs == rhs); }
+
+template <typename Point, typename T, typename Comp, typename Alloc>
+void swap (interval_map<Point, T, Comp, Alloc> & lhs,
+           interval_map<Point, T, Comp, Alloc> & rhs)
+{ lhs.swap(rhs); }
+
+} // namespace
+
+#endif /* FT_INTERVAL_MAP_HPP */
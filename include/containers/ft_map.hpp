@@ -3,16 +3,33 @@
 
 #include <memory> // std::allocator
 #include <functional> // std::less
+#include <utility> // std::move
 
 #include "ft_pair.hpp"
 #include "rb_tree.hpp"
+#include "ft_rb_tree_iterator.hpp"
 #include "ft_type_traits.hpp"
 
 namespace ft {
 
-/// @note Allocator won't be used. This map uses rb_tree allocator.
+/// @note `Allocator` is rebound to the rb_tree node type: nodes, and the
+///       pools of the storage policies, all come from it.
+/// @note `Augment` is the rb_tree augmentation policy. Pass
+///       `rb_order_statistics` for `nth`, `rank` and `count_range`, or an
+///       `rb_monoid` for `aggregate`. As the latter summarises mapped
+///       values, they are then read-only through iterators and
+///       `operator[]`, and only change through `update` and `modify`, which
+///       keep the summaries right.
+/// @note `Links` is the rb_tree links policy. `rb_index_links` packs nodes
+///       in slabs with 32-bit links, but then node handles and `merge` are
+///       not available.
+/// @note `Storage` is the rb_tree storage policy. `rb_slab_storage` carves
+///       nodes out of slabs and recycles erased ones, with the same limits.
 template <typename Key, typename T, typename Compare = std::less<Key>,
-          typename Allocator = std::allocator<pair<typename ft::add_const<Key>::type, T> >
+          typename Allocator = std::allocator<pair<typename ft::add_const<Key>::type, T> >,
+          typename Augment = rb_no_augment,
+          typename Links = rb_pointer_links,
+          typename Storage = rb_heap_storage
 > class map
 {
     /**************************************************************************/
@@ -29,7 +46,7 @@ template <typename Key, typename T, typename Compare = std::less<Key>,
     typedef T	                mapped_type;
     typedef pair<Key const, T>	value_type;
     typedef Compare	            key_compare;
-    typedef Allocator           allocator_type; // not used (but still present!)
+    typedef Allocator           allocator_type;
     typedef size_t              size_type;
     typedef ptrdiff_t           difference_type;
     typedef value_type &        reference;
@@ -40,188 +57,150 @@ template <typename Key, typename T, typename Compare = std::less<Key>,
     private:
 
     /// @note just some convenient typedefs
-    typedef rb_tree<value_type, value_compare> btree_type;
-    typedef typename btree_type::value_type     node_type;
+    typedef rb_tree<value_type, value_compare, Augment, rb_unique_keys,
+                    Links, Storage, Allocator> btree_type;
+    typedef typename btree_type::allocator_type node_allocator_type;
+    typedef typename btree_type::value_type     tree_node;
     typedef typename btree_type::value_type &   node_reference;
     typedef typename btree_type::value_type *   node_pointer;
+    typedef typename ft::conditional<Augment::reads_mapped,
+            value_type const, value_type>::type             iterated_type;
+    typedef typename ft::conditional<Augment::reads_mapped,
+            T const &, T &>::type                           mapped_reference;
 
-    template <typename U = T>
-    class map_iterator : public iterator<bidirectional_iterator_tag, U>
-    {
-        public:
+    public:
 
-        typedef iterator_traits<map_iterator>       traits; // to shorten below
-        typedef typename traits::iterator_category  iterator_category;
-        typedef typename traits::value_type         value_type;
-        typedef typename traits::difference_type    difference_type;
-        typedef typename traits::pointer	        pointer;
-        typedef typename traits::reference	        reference;
+    typedef rb_tree_iterator<tree_node, iterated_type>      iterator;
+    typedef rb_tree_iterator<tree_node, value_type const>   const_iterator;
 
-        private:
+    typedef ft::reverse_iterator<iterator>                  reverse_iterator;
+    typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
 
-        node_pointer _current;
-        node_pointer _sentinel;
+    class value_compare
+    {
+        /// @note since `value_compare` is defined here as protected but `map`
+        //  wants acces to it, we declare it as a `friend` class.
+        friend class map;
 
-        public:
+        protected:
 
-        /// @brief Constructor by default
-        map_iterator (node_pointer current = NULL, node_pointer sentinel = NULL)
-        :_current(current), _sentinel(sentinel)
-        { }
+        Compare comp;
+        value_compare (Compare c) : comp(c) { }
 
-        /// @brief Constructor by copy from mutable iterator
-        map_iterator (map_iterator<typename ft::remove_const<value_type>::type> const & it)
-        : _current(it.current_node()),
-         _sentinel(const_cast<node_pointer>(it.sentinel_node()))
-        { }
+        public:
 
-        /// @brief Constructor by copy from const iterator
-        map_iterator (map_iterator<typename ft::add_const<value_type>::type> const & it)
-        : _current(const_cast<node_pointer>(it.current_node())),
-         _sentinel(const_cast<node_pointer>(it.sentinel_node()))
-        { }
+        /// @note We shoudn't have this. But we use it since this class need to
+        ///       be construted inside rbtree. We could also template it over
+        ///       `Compare` to give rbtree second type argument the right type.
+        value_compare () { }
 
-        map_iterator operator= (map_iterator const & it)
-        {
-            _current = it.current_node();
-            _sentinel = it.sentinel_node();
-            return *this;
-        }
+        typedef bool        result_type;
+        typedef value_type  first_argument_type;
+        typedef value_type  second_argument_type;
 
-        reference operator* () const
-        { return _current->key; }
+        bool operator () (value_type const & a, value_type const & b) const
+        { return comp(a.first, b.first); }
 
-        pointer operator-> () const
-        { return &_current->key; }
+        /// @brief Element against key, to look keys up without building an
+        ///        element. `K` is `key_type`, or any type a transparent
+        ///        `Compare` takes.
+        template <typename K>
+        bool operator () (value_type const & a, K const & key) const
+        { return comp(a.first, key); }
 
-        bool operator== (map_iterator const & it) const
-        { return _current == it.current_node(); }
+        template <typename K>
+        bool operator () (K const & key, value_type const & b) const
+        { return comp(key, b.first); }
 
-        bool operator!= (map_iterator const & it) const
-        { return !(*this == it); }
+    };
 
-        /// @brief prefix incerement
-        map_iterator & operator++ ()
-        {
-            // case 1: next node is min(_current->right)
-            if (_current->right != _sentinel)
-            {
-                _current = _current->right;
-                while (_current != _sentinel && _current->left != _sentinel)
-                    _current = _current->left;
-                return *this;
-            }
+#if __cplusplus >= 201103L
+    /// @brief Node handle, as C++17's: owns an element extracted from a map,
+    ///        in its node, until it is inserted in a map again
+    /// @note Move only. A handle still holding a node destroys it.
+    class node_type
+    {
+        friend class map;
 
-            // case 2: next node is parent
-            if (_current->parent != _sentinel && _current == _current->parent->left)
-            {
-                _current = _current->parent;
-                return *this;
-            }
+        public:
 
-            // case 3: next node is further parent or not at all
-            _current = _current->parent;
-            while (_current != _sentinel
-                && _current->parent != _sentinel
-                && _current == _current->parent->left)
-                _current = _current->parent;
+        typedef Key         key_type;
+        typedef T           mapped_type;
+        typedef Allocator   allocator_type;
 
-            if (_current->parent == _sentinel)
-                _current = _sentinel;
+        node_type () : _node(NULL) { }
 
-            return *this;
-        }
+        node_type (node_type && n)
+        : _alloc(n._alloc), _node(n._node) { n._node = NULL; }
 
-        /// @brief prefix decerement
-        map_iterator & operator-- ()
-        {
-            // case 0: previous node is max(root)
-            if (_current == _sentinel)
-            {
-                _current = _current->right;
-                while (_current != _sentinel && _current->right != _sentinel)
-                    _current = _current->right;
-                return *this;
-            }
+        node_type (node_type const &) = delete;
+        node_type & operator= (node_type const &) = delete;
 
-            // case 1: previous node is max(_current->left)
-            if (_current->left != _sentinel)
-            {
-                _current = _current->left;
-                while (_current != _sentinel && _current->right != _sentinel)
-                    _current = _current->right;
-                return *this;
-            }
+        ~node_type ()
+        { _destroy(); }
 
-            // case 2: previous node is parent
-            if (_current->parent != _sentinel && _current == _current->parent->right)
+        node_type & operator= (node_type && n)
+        {
+            if (this != &n)
             {
-                _current = _current->parent;
-                return *this;
+                _destroy();
+                _alloc = n._alloc;
+                _node = n._node;
+                n._node = NULL;
             }
-
-            // case 3: previous node is further parent or not at all
-            _current = _current->parent;
-            while (_current != _sentinel
-                && _current->parent != _sentinel
-                && _current == _current->parent->right)
-                _current = _current->parent;
-
-            if (_current->parent == _sentinel)
-                _current = _sentinel;
-
             return *this;
         }
 
-        /// @brief postfix incerement
-        map_iterator operator++ (int)
-        { map_iterator tmp = *this; this->operator++(); return tmp; }
+        bool empty () const
+        { return _node == NULL; }
 
-        /// @brief postfix decerement
-        map_iterator operator-- (int)
-        { map_iterator tmp = *this; this->operator--(); return tmp; }
+        explicit operator bool () const
+        { return _node != NULL; }
 
-        node_pointer current_node () const
-        { return _current; }
+        /// @note Writable, as `std::map::node_type::key`: the node is out of
+        ///       any tree, so its key can change before it is inserted again.
+        key_type & key () const
+        { return const_cast<key_type &>(_node->key.first); }
 
-        node_pointer sentinel_node () const
-        { return _sentinel; }
-    };
-
-    public:
-
-    typedef map_iterator<value_type>                iterator;
-    typedef map_iterator<value_type const>          const_iterator;
-
-    typedef ft::reverse_iterator<iterator>          reverse_iterator;
-    typedef ft::reverse_iterator<const_iterator>    const_reverse_iterator;
-
-    class value_compare
-    {
-        /// @note since `value_compare` is defined here as protected but `map`
-        //  wants acces to it, we declare it as a `friend` class.
-        friend class map;
+        mapped_type & mapped () const
+        { return _node->key.second; }
 
-        protected:
+        allocator_type get_allocator () const
+        { return allocator_type(_alloc); }
 
-        Compare comp;
-        value_compare (Compare c) : comp(c) { }
+        void swap (node_type & n)
+        {
+            std::swap(_alloc, n._alloc);
+            std::swap(_node, n._node);
+        }
 
-        public:
+        private:
 
-        /// @note We shoudn't have this. But we use it since this class need to
-        ///       be construted inside rbtree. We could also template it over
-        ///       `Compare` to give rbtree second type argument the right type.
-        value_compare () { }
+        node_allocator_type _alloc;
+        node_pointer        _node;
 
-        typedef bool        result_type;
-        typedef value_type  first_argument_type;
-        typedef value_type  second_argument_type;
+        node_type (node_allocator_type const & alloc, node_pointer node)
+        : _alloc(alloc), _node(node) { }
 
-        bool operator () (value_type const & a, value_type const & b) const
-        { return comp(a.first, b.first); }
+        void _destroy ()
+        {
+            if (_node)
+            {
+                _alloc.destroy(_node);
+                _alloc.deallocate(_node, 1);
+            }
+        }
+    };
 
+    /// @brief Result of `insert(node_type &&)`: where the key is, whether
+    ///        the node was inserted, and the node back when it was not
+    struct insert_return_type
+    {
+        iterator    position;
+        bool        inserted;
+        node_type   node;
     };
+#endif
 
     /**************************************************************************/
     /*                                                                        */
@@ -248,7 +227,8 @@ template <typename Key, typename T, typename Compare = std::less<Key>,
     /// @brief Constructor by default (1)
     explicit map (key_compare const & comp = key_compare(),
                 Allocator const & alloc = Allocator())
-    : _key_comp(comp), _value_comp(comp) { (void)alloc; }
+    : _key_comp(comp), _value_comp(comp), _tree(node_allocator_type(alloc))
+    { }
 
     /// @brief Constructor by range (2)
     template <class InputIterator>
@@ -256,20 +236,51 @@ template <typename Key, typename T, typename Compare = std::less<Key>,
         key_compare const & comp = key_compare(),
         Allocator const & alloc = Allocator(),
         typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
-    : _key_comp(comp), _value_comp(comp) { (void)alloc; insert(first, last); }
+    : _key_comp(comp), _value_comp(comp), _tree(node_allocator_type(alloc))
+    { insert(first, last); }
 
     /// @brief Constructor by copy (3)
+    /// @note The allocator of `a` is copied along.
     map (map const & a)
     : _key_comp(a._key_comp), _value_comp(a._key_comp), _tree(a._tree) { }
 
+    /// @brief Constructor by copy with another allocator (3)
+    map (map const & a, Allocator const & alloc)
+    : _key_comp(a._key_comp), _value_comp(a._key_comp),
+      _tree(a._tree, node_allocator_type(alloc)) { }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (4)
+    map (map && a)
+    : _key_comp(a._key_comp), _value_comp(a._key_comp),
+      _tree(std::move(a._tree)) { }
+#endif
+
     /****** Destructor ********************************************************/
 
     ~map () { }
 
     /****** Element access ****************************************************/
 
-    mapped_type & operator[] (key_type const & key)
-    { return (insert(make_pair(key, mapped_type())).first)->second; }
+    /// @note An element is only built when `key` is missing, then inserted
+    ///       with its lower bound as hint: no second descent.
+    mapped_reference operator[] (key_type const & key)
+    {
+#if __cplusplus >= 201103L
+        return try_emplace(key).first->second;
+#else
+        node_pointer p = _tree.lower_bound(key);
+
+        if (p == _tree.sentinel() || _key_comp(key, p->key.first))
+            p = _tree.insert_unique(p, value_type(key, mapped_type())).first;
+        return p->key.second;
+#endif
+    }
+
+#if __cplusplus >= 201103L
+    mapped_reference operator[] (key_type && key)
+    { return try_emplace(std::move(key)).first->second; }
+#endif
 
     /****** Capacity **********************************************************/
 
@@ -280,58 +291,175 @@ template <typename Key, typename T, typename Compare = std::less<Key>,
     { return _tree.size(); }
 
     size_type max_size () const
-    { return _tree.get_allocator().max_size(); }
+    { return _tree.max_size(); }
 
     /****** Modifiers *********************************************************/
 
     /// @brief Insert single element (1)
     pair<iterator, bool> insert (value_type const & val)
     {
-        if (find(val.first) == end())
-        {
-            _tree.insert(val);
-            return make_pair(iterator(find(val.first)), true);
-        }
-        return make_pair(find(val.first), false);
+        pair<node_pointer, bool> p = _tree.insert_unique(val);
+        return pair<iterator, bool>(iterator(p.first, _tree.sentinel()), p.second);
     }
 
     /// @brief Insert with hint (2)
     iterator insert (iterator position, value_type const & val)
-    { (void)position; insert(val); return find(val.first); }
+    {
+        node_pointer p = _tree.insert_unique(position.current_node(), val).first;
+        return iterator(p, _tree.sentinel());
+    }
 
     /// @brief Insert by iterator range (3)
     template <class InputIterator>
     void insert (InputIterator first, InputIterator last,
     typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
-    { for (; first != last; first++) insert(*first); }
+    { _tree.insert_range(first, last); }
+
+#if __cplusplus >= 201103L
+    /// @brief Insert an element constructed out of `args` right in its node
+    /// @note As with `std::map`, the element has to be built before its key
+    ///       can be looked up: `try_emplace` builds nothing when `key` is in.
+    template <typename... Args>
+    pair<iterator, bool> emplace (Args &&... args)
+    {
+        pair<node_pointer, bool> p =
+            _tree.emplace_unique(std::forward<Args>(args)...);
+        return pair<iterator, bool>(iterator(p.first, _tree.sentinel()), p.second);
+    }
+
+    /// @brief Insert `key` with a value constructed out of `args`, unless
+    ///        `key` is already in
+    /// @note On a hit, nothing is constructed and `args` are left untouched.
+    template <typename... Args>
+    pair<iterator, bool> try_emplace (key_type const & key, Args &&... args)
+    { return _try_emplace(key, std::forward<Args>(args)...); }
+
+    template <typename... Args>
+    pair<iterator, bool> try_emplace (key_type && key, Args &&... args)
+    { return _try_emplace(std::move(key), std::forward<Args>(args)...); }
+
+    /// @brief Assign `obj` to the value of `key`, or insert `key` with a
+    ///        value constructed out of `obj`
+    /// @return Element of key `key` and whether it has just been inserted
+    template <typename M>
+    pair<iterator, bool> insert_or_assign (key_type const & key, M && obj)
+    { return _insert_or_assign(key, std::forward<M>(obj)); }
+
+    template <typename M>
+    pair<iterator, bool> insert_or_assign (key_type && key, M && obj)
+    { return _insert_or_assign(std::move(key), std::forward<M>(obj)); }
+
+    /// @brief Insert the node held by `nh`, unless its key is already in
+    /// @note No allocation, no copy: the node itself is linked. When the
+    ///       key is already in, the node is handed back in the result. A
+    ///       node from an allocator not equal to ours can't be freed by ours
+    ///       later: its element is then moved into a node of this map.
+    insert_return_type insert (node_type && nh)
+    {
+        if (nh.empty())
+            return insert_return_type{end(), false, node_type()};
+        if (nh._alloc != _tree.get_allocator())
+            return _insert_moved(std::move(nh));
+
+        pair<node_pointer, bool> p = _tree.insert_unique_node(nh._node);
+        iterator position(p.first, _tree.sentinel());
+
+        if (!p.second)
+            return insert_return_type{position, false, std::move(nh)};
+        nh._node = NULL;
+        return insert_return_type{position, true, node_type()};
+    }
+
+    /// @brief Unlink the element at `position` and hand its node over
+    node_type extract (const_iterator position)
+    {
+        btree_type::movable_nodes();
+        return node_type(_tree.get_allocator(),
+                         _tree.extract(position.current_node()));
+    }
+
+    /// @brief Unlink the element of key `key`, if any, and hand its node over
+    node_type extract (key_type const & key)
+    {
+        node_pointer p = _tree.find(key);
+        return p ? extract(const_iterator(p, _tree.sentinel())) : node_type();
+    }
+#endif
 
     /// @brief erase by iterator position (1)
     void erase (iterator position)
-    { return _tree.erase(*position); }
-    //{ return _tree.erase(position); }
+    { _tree.erase(position.current_node()); }
 
     /// @brief erase by key (2)
-    /// @note always return 1 since our map doesn't support duplicated keys
+    /// @return 1 if `key` was found and erased, 0 otherwise
     size_type erase (key_type const & key)
-    { _tree.erase(value_type(key, mapped_type())); return 1; }
+    { return _tree.erase(key); }
 
     /// @brief erase by iterator range (3)
     void erase (iterator first, iterator last)
+    { _tree.erase(first.current_node(), last.current_node()); }
+
+    /// @brief Assign `obj` to the mapped value at `position`
+    /// @note The way to change mapped values summarised by `Augment`: the
+    ///       summaries above are refreshed, in O(log n).
+    void update (iterator position, mapped_type const & obj)
     {
-        iterator node;
-        while (first != last)
-        {
-            node = first;
-            ++first;
-            erase(node);
-        }
+        node_pointer p = position.current_node();
+
+        p->key.second = obj;
+        _tree.refresh(p);
+    }
+
+    /// @brief Call `f` on the mapped value at `position`, then refresh the
+    ///        summaries above as `update` does
+    template <typename F>
+    void modify (iterator position, F f)
+    {
+        node_pointer p = position.current_node();
+
+        f(p->key.second);
+        _tree.refresh(p);
     }
 
     void swap (map & m)
-    { map tmp(m); m = *this; *this = tmp; }
+    {
+        key_compare key_comp = _key_comp;
+        value_compare value_comp = _value_comp;
+
+        _key_comp = m._key_comp;
+        _value_comp = m._value_comp;
+        _tree.swap(m._tree);
+
+        m._key_comp = key_comp;
+        m._value_comp = value_comp;
+    }
 
     void clear ()
-    { erase(begin(), end()); }
+    { _tree.clear(); }
+
+    /// @brief Move every element of `m` whose key is missing over here
+    /// @note Nodes are relinked from `m` to this map, so nothing is allocated
+    ///       nor copied. Elements whose key was already here stay in `m`.
+    ///       Should the allocators not compare equal, elements are copied
+    ///       over and erased from `m` instead.
+    void merge (map & m)
+    { _tree.merge_unique(m._tree); }
+
+    /// @brief Insert a copy of every element of `m` whose key is missing
+    /// @note O(m log(n/m + 1)) with m <= n the sizes of both maps. Elements
+    ///       already there keep their mapped value.
+    void merge_union (map const & m)
+    { _tree.merge_union(m._tree); }
+
+    /// @brief Erase every element whose key is missing in `m`
+    /// @note O(m log(n/m + 1)) with m <= n the sizes of both maps
+    void intersection (map const & m)
+    { _tree.intersection(m._tree); }
+
+    /// @brief Erase every element whose key is in `m`
+    /// @note O(m log(n/m + 1)) with m <= n the sizes of both maps
+    void difference (map const & m)
+    { _tree.difference(m._tree); }
 
     /****** Observers *********************************************************/
 
@@ -344,10 +472,10 @@ template <typename Key, typename T, typename Compare = std::less<Key>,
     /****** Iterators *********************************************************/
 
     iterator begin ()
-    { return iterator(_tree.min(_tree.root()), _tree.sentinel()); }
+    { return iterator(_tree.leftmost(), _tree.sentinel()); }
 
     const_iterator begin () const
-    { return const_iterator(_tree.min(_tree.root()), _tree.sentinel()); }
+    { return const_iterator(_tree.leftmost(), _tree.sentinel()); }
 
     iterator end ()
     { return iterator(_tree.sentinel(), _tree.sentinel()); }
@@ -370,69 +498,244 @@ template <typename Key, typename T, typename Compare = std::less<Key>,
     /****** Operations ********************************************************/
 
     iterator find (key_type const & key)
-    {
-        node_pointer p = _tree.find(value_type(key, mapped_type()));
-        return p ? iterator(p, _tree.sentinel()) : end();
-    }
+    { return _find<iterator>(key); }
 
     const_iterator find (key_type const & key) const
-    {
-        node_pointer p = _tree.find(value_type(key, mapped_type()));
-        return p ? const_iterator(p, _tree.sentinel()) : end();
-    }
+    { return _find<const_iterator>(key); }
 
-    size_type count (key_type const & key)
+    size_type count (key_type const & key) const
     { return find(key) == end() ? 0 : 1; }
 
+    /// @brief Find every key of [first, last), in order, into `out`, as
+    ///        many `find` but with their descents interleaved
+    /// @note For large batches over a tree bigger than the caches, such as
+    ///       the probe side of a join. Misses come out as `end()`.
+    template <class ForwardIt, class OutputIt>
+    OutputIt find_batch (ForwardIt first, ForwardIt last, OutputIt out)
+    { return _find_batch<iterator>(first, last, out); }
+
+    template <class ForwardIt, class OutputIt>
+    OutputIt find_batch (ForwardIt first, ForwardIt last, OutputIt out) const
+    { return _find_batch<const_iterator>(first, last, out); }
+
     iterator lower_bound (key_type const & key)
-    {
-        iterator it = begin(), ite = end();
-        while (it != ite && _key_comp((*it).first, key)) it++;
-        return it;
-    }
+    { return iterator(_tree.lower_bound(key), _tree.sentinel()); }
 
     const_iterator lower_bound (key_type const & key) const
-    {
-        const_iterator it = begin(), ite = end();
-        while (it != ite && _key_comp((*it).first, key)) it++;
-        return it;
-    }
+    { return const_iterator(_tree.lower_bound(key), _tree.sentinel()); }
 
     iterator upper_bound (key_type const & key)
-    {
-        iterator it = begin(), ite = end();
-        while (it != ite && !_key_comp(key, (*it).first)) it++;
-        return it;
-    }
+    { return iterator(_tree.upper_bound(key), _tree.sentinel()); }
 
     const_iterator upper_bound (key_type const & key) const
-    {
-        const_iterator it = begin(), ite = end();
-        while (it != ite && !_key_comp(key, (*it).first)) it++;
-        return it;
-    }
+    { return const_iterator(_tree.upper_bound(key), _tree.sentinel()); }
 
     pair<iterator, iterator>
     equal_range (key_type const & key)
-    { return pair<iterator, iterator>(lower_bound(key), upper_bound(key)); }
+    { return _equal_range<iterator>(key); }
 
     pair<const_iterator, const_iterator>
     equal_range (key_type const & key) const
-    { return pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key)); }
+    { return _equal_range<const_iterator>(key); }
+
+    /****** Heterogeneous lookup **********************************************/
+
+    /// @note Only with a transparent `Compare`, one declaring an
+    ///       `is_transparent` type: `key` is any type it compares with
+    ///       `key_type`, e.g. a `char const *` for string keys, so lookups
+    ///       build no `key_type`.
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+    find (K const & key)
+    { return _find<iterator>(key); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+    find (K const & key) const
+    { return _find<const_iterator>(key); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, size_type>::type
+    count (K const & key) const
+    { return find(key) == end() ? 0 : 1; }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+    lower_bound (K const & key)
+    { return iterator(_tree.lower_bound(key), _tree.sentinel()); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+    lower_bound (K const & key) const
+    { return const_iterator(_tree.lower_bound(key), _tree.sentinel()); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+    upper_bound (K const & key)
+    { return iterator(_tree.upper_bound(key), _tree.sentinel()); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+    upper_bound (K const & key) const
+    { return const_iterator(_tree.upper_bound(key), _tree.sentinel()); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K,
+                                      pair<iterator, iterator> >::type
+    equal_range (K const & key)
+    { return _equal_range<iterator>(key); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K,
+                                      pair<const_iterator, const_iterator> >::type
+    equal_range (K const & key) const
+    { return _equal_range<const_iterator>(key); }
+
+    /****** Order statistics **************************************************/
+
+    /// @note Only with the `rb_order_statistics` augmentation, O(log n) each.
+
+    /// @return Iterator to the element of rank `k` (0 for begin), or end
+    iterator nth (size_type k)
+    { return iterator(_tree.select(k), _tree.sentinel()); }
+
+    const_iterator nth (size_type k) const
+    { return const_iterator(_tree.select(k), _tree.sentinel()); }
+
+    /// @return Number of elements whose key is less than `key`
+    size_type rank (key_type const & key) const
+    { return _tree.rank(key); }
+
+    /// @return Number of elements whose key is in [lo, hi)
+    size_type count_range (key_type const & lo, key_type const & hi) const
+    { return _tree.count_range(lo, hi); }
+
+    /****** Range aggregates **************************************************/
+
+    /// @note Only with an `rb_monoid` augmentation, e.g. `rb_monoid<rb_sum<T> >`.
+
+    /// @return Fold of every element, in O(1)
+    typename btree_type::summary_type aggregate () const
+    { return _tree.aggregate(); }
+
+    /// @return Fold of the elements whose key is in [lo, hi), in O(log n)
+    typename btree_type::summary_type
+    aggregate (key_type const & lo, key_type const & hi) const
+    { return _tree.aggregate(lo, hi); }
 
     /****** Miscellaneous *****************************************************/
 
     allocator_type get_allocator () const
-    { return _tree.get_allocator(); }
+    { return allocator_type(_tree.get_allocator()); }
 
+    /// @note The map keeps its allocator, which copies the elements of `m`.
     map & operator= (map const & m)
     { _tree = m._tree; return *this; }
 
+#if __cplusplus >= 201103L
+    map & operator= (map && m)
+    {
+        _key_comp = m._key_comp;
+        _value_comp = m._value_comp;
+        _tree = std::move(m._tree);
+        return *this;
+    }
+#endif
+
+    /****** Internals *********************************************************/
+
+    private:
+
+    template <typename It, typename K>
+    It _find (K const & key) const
+    {
+        node_pointer p = _tree.find(key);
+        return It(p ? p : _tree.sentinel(), _tree.sentinel());
+    }
+
+    template <typename It, typename ForwardIt, typename OutputIt>
+    OutputIt _find_batch (ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        node_pointer found[btree_type::batch_width];
+
+        while (first != last)
+        {
+            ForwardIt next = _tree.find_batch(first, last, found);
+            for (size_t i = 0; first != next; ++first, ++i)
+                *out++ = It(found[i], _tree.sentinel());
+        }
+        return out;
+    }
+
+    template <typename It, typename K>
+    pair<It, It> _equal_range (K const & key) const
+    {
+        pair<node_pointer, node_pointer> p = _tree.equal_range(key);
+        return pair<It, It>(It(p.first, _tree.sentinel()),
+                            It(p.second, _tree.sentinel()));
+    }
+
+#if __cplusplus >= 201103L
+    /// @note The lower bound of a missing key is right where it belongs, so
+    ///       the node is linked there with no further comparison.
+    template <typename K, typename... Args>
+    pair<iterator, bool> _try_emplace (K && key, Args &&... args)
+    {
+        node_pointer p = _tree.lower_bound(key);
+
+        if (p != _tree.sentinel() && !_key_comp(key, p->key.first))
+            return pair<iterator, bool>(iterator(p, _tree.sentinel()), false);
+        p = _tree.emplace_before(p, std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...));
+        return pair<iterator, bool>(iterator(p, _tree.sentinel()), true);
+    }
+
+    /// @note The node of `nh` stays with its allocator: destroyed by `nh`
+    ///       once its element is moved out, or handed back as it is.
+    insert_return_type _insert_moved (node_type && nh)
+    {
+        node_pointer p = _tree.lower_bound(nh.key());
+
+        if (p != _tree.sentinel() && !_key_comp(nh.key(), p->key.first))
+            return insert_return_type{iterator(p, _tree.sentinel()), false,
+                                      std::move(nh)};
+        p = _tree.emplace_before(p, std::move(nh._node->key));
+        nh = node_type();
+        return insert_return_type{iterator(p, _tree.sentinel()), true,
+                                  node_type()};
+    }
+
+    /// @note `obj` is only used by one of the two branches. An assigned
+    ///       value may be summarised, hence the refresh.
+    template <typename K, typename M>
+    pair<iterator, bool> _insert_or_assign (K && key, M && obj)
+    {
+        node_pointer p = _tree.lower_bound(key);
+
+        if (p != _tree.sentinel() && !_key_comp(key, p->key.first))
+        {
+            p->key.second = std::forward<M>(obj);
+            _tree.refresh(p);
+            return pair<iterator, bool>(iterator(p, _tree.sentinel()), false);
+        }
+        p = _tree.emplace_before(p, std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(key)),
+                std::forward_as_tuple(std::forward<M>(obj)));
+        return pair<iterator, bool>(iterator(p, _tree.sentinel()), true);
+    }
+#endif
+
+    public:
+
     /// @note since the following operator is defined outside of `map` but still
     /// want to acces its private members, we declare it here as a `friend`.
-    template <typename Key_, typename T_, typename Comp_, typename Alloc_>
-    friend bool operator== (map<Key_, T_, Comp_, Alloc_> const & lhs,
-                            map<Key_, T_, Comp_, Alloc_> const & rhs);
+    template <typename Key_, typename T_, typename Comp_, typename Alloc_,
+              typename Aug_, typename Links_, typename Stor_>
+    friend bool
+    operator== (map<Key_, T_, Comp_, Alloc_, Aug_, Links_, Stor_> const & lhs,
+                map<Key_, T_, Comp_, Alloc_, Aug_, Links_, Stor_> const & rhs);
 
 };
 
@@ -444,45 +747,60 @@ template <typename Key, typename T, typename Compare = std::less<Key>,
 
 /// @note not possible to compare underlying tree since they are private and we
 ///       not allowed to add public methods from stl spec.
-template <typename Key, typename T, typename Comp, typename Alloc>
-bool operator== (map<Key, T, Comp, Alloc> const & lhs,
-                 map<Key, T, Comp, Alloc> const & rhs)
+template <typename Key, typename T, typename Comp, typename Alloc, typename Aug,
+          typename Links, typename Stor>
+bool operator== (map<Key, T, Comp, Alloc, Aug, Links, Stor> const & lhs,
+                 map<Key, T, Comp, Alloc, Aug, Links, Stor> const & rhs)
 {
-    typename map<Key, T, Comp, Alloc>::const_iterator lit = lhs.begin();
-    typename map<Key, T, Comp, Alloc>::const_iterator rit = rhs.begin();
-    typename map<Key, T, Comp, Alloc>::const_iterator lite = lhs.end();
-    typename map<Key, T, Comp, Alloc>::const_iterator rite = rhs.end();
+    typedef typename map<Key, T, Comp, Alloc, Aug, Links, Stor>::const_iterator
+        const_iterator;
+
+    const_iterator lit = lhs.begin();
+    const_iterator rit = rhs.begin();
+    const_iterator lite = lhs.end();
+    const_iterator rite = rhs.end();
 
     for (; lit != lite && rit != rite && *lit == *rit; lit++, rit++);
     return (lit == lite && rit == rite);
 }
 
-template <typename Key, typename T, typename Comp, typename Alloc>
-bool operator!= (map<Key, T, Comp, Alloc> const & lhs,
-                 map<Key, T, Comp, Alloc> const & rhs)
+template <typename Key, typename T, typename Comp, typename Alloc, typename Aug,
+          typename Links, typename Stor>
+bool operator!= (map<Key, T, Comp, Alloc, Aug, Links, Stor> const & lhs,
+                 map<Key, T, Comp, Alloc, Aug, Links, Stor> const & rhs)
 { return !(lhs == rhs); }
 
-template <typename Key, typename T, typename Comp, typename Alloc>
-bool operator< (map<Key, T, Comp, Alloc> const & lhs,
-                map<Key, T, Comp, Alloc> const & rhs)
+template <typename Key, typename T, typename Comp, typename Alloc, typename Aug,
+          typename Links, typename Stor>
+void swap (map<Key, T, Comp, Alloc, Aug, Links, Stor> & lhs,
+           map<Key, T, Comp, Alloc, Aug, Links, Stor> & rhs)
+{ lhs.swap(rhs); }
+
+template <typename Key, typename T, typename Comp, typename Alloc, typename Aug,
+          typename Links, typename Stor>
+bool operator< (map<Key, T, Comp, Alloc, Aug, Links, Stor> const & lhs,
+                map<Key, T, Comp, Alloc, Aug, Links, Stor> const & rhs)
 {
     return
     lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <typename Key, typename T, typename Comp, typename Alloc>
-bool operator> (map<Key, T, Comp, Alloc> const & lhs,
-                map<Key, T, Comp, Alloc> const & rhs)
+template <typename Key, typename T, typename Comp, typename Alloc, typename Aug,
+          typename Links, typename Stor>
+bool operator> (map<Key, T, Comp, Alloc, Aug, Links, Stor> const & lhs,
+                map<Key, T, Comp, Alloc, Aug, Links, Stor> const & rhs)
 { return rhs < lhs; }
 
-template <typename Key, typename T, typename Comp, typename Alloc>
-bool operator<= (map<Key, T, Comp, Alloc> const & lhs,
-                 map<Key, T, Comp, Alloc> const & rhs)
+template <typename Key, typename T, typename Comp, typename Alloc, typename Aug,
+          typename Links, typename Stor>
+bool operator<= (map<Key, T, Comp, Alloc, Aug, Links, Stor> const & lhs,
+                 map<Key, T, Comp, Alloc, Aug, Links, Stor> const & rhs)
 { return !(rhs < lhs); }
 
-template <typename Key, typename T, typename Comp, typename Alloc>
-bool operator>= (map<Key, T, Comp, Alloc> const & lhs,
-                 map<Key, T, Comp, Alloc> const & rhs)
+template <typename Key, typename T, typename Comp, typename Alloc, typename Aug,
+          typename Links, typename Stor>
+bool operator>= (map<Key, T, Comp, Alloc, Aug, Links, Stor> const & lhs,
+                 map<Key, T, Comp, Alloc, Aug, Links, Stor> const & rhs)
 { return !(lhs < rhs); }
 
 } // namespace
@@ -0,0 +1,422 @@
+#ifndef FT_MULTIMAP_HPP
+#define FT_MULTIMAP_HPP 1
+
+#include <memory> // std::allocator
+#include <functional> // std::less
+#include <utility> // std::move
+
+#include "ft_pair.hpp"
+#include "rb_tree.hpp"
+#include "ft_rb_tree_iterator.hpp"
+#include "ft_reverse_iterator.hpp"
+#include "ft_lexicographical_compare.hpp"
+#include "ft_type_traits.hpp"
+
+namespace ft {
+
+/// @brief Sorted associative container of key-value pairs, equivalent keys
+///        allowed, as `std::multimap`
+/// @note Elements of equivalent keys are stored side by side in insertion
+///       order, each in its own rb_tree node: no per key container.
+/// @note Allocator won't be used. This multimap uses rb_tree allocator.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<pair<typename ft::add_const<Key>::type, T> >
+> class multimap
+{
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member types                                                      */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    class value_compare; // forward declaration
+
+    typedef Key	                key_type;
+    typedef T	                mapped_type;
+    typedef pair<Key const, T>	value_type;
+    typedef Compare	            key_compare;
+    typedef Allocator           allocator_type; // not used
+    typedef size_t              size_type;
+    typedef ptrdiff_t           difference_type;
+    typedef value_type &        reference;
+    typedef value_type const &  const_reference;
+    typedef value_type *        pointer;
+    typedef value_type const *  const_pointer;
+
+    private:
+
+    /// @note just some convenient typedefs
+    typedef rb_tree<value_type, value_compare, rb_no_augment, rb_equal_keys>
+                                                btree_type;
+    typedef typename btree_type::value_type     node_type;
+    typedef typename btree_type::value_type *   node_pointer;
+
+    public:
+
+    typedef rb_tree_iterator<node_type, value_type>         iterator;
+    typedef rb_tree_iterator<node_type, value_type const>   const_iterator;
+
+    typedef ft::reverse_iterator<iterator>                  reverse_iterator;
+    typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
+
+    class value_compare
+    {
+        friend class multimap;
+
+        protected:
+
+        Compare comp;
+        value_compare (Compare c) : comp(c) { }
+
+        public:
+
+        /// @note Needed by rb_tree, which constructs its comparison itself
+        value_compare () { }
+
+        typedef bool        result_type;
+        typedef value_type  first_argument_type;
+        typedef value_type  second_argument_type;
+
+        bool operator () (value_type const & a, value_type const & b) const
+        { return comp(a.first, b.first); }
+
+        /// @brief Element against key, to look keys up without building an
+        ///        element. `K` is `key_type`, or any type a transparent
+        ///        `Compare` takes.
+        template <typename K>
+        bool operator () (value_type const & a, K const & key) const
+        { return comp(a.first, key); }
+
+        template <typename K>
+        bool operator () (K const & key, value_type const & b) const
+        { return comp(key, b.first); }
+    };
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Internal data                                                     */
+    /*                                                                        */
+    /**************************************************************************/
+
+    private:
+
+    key_compare     _key_comp;
+    value_compare   _value_comp;
+    btree_type      _tree;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member functions                                                  */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    /****** Constructors ******************************************************/
+
+    /// @brief Constructor by default (1)
+    explicit multimap (key_compare const & comp = key_compare(),
+                       Allocator const & alloc = Allocator())
+    : _key_comp(comp), _value_comp(comp) { (void)alloc; }
+
+    /// @brief Constructor by range (2)
+    template <class InputIterator>
+    multimap (InputIterator first, InputIterator last,
+        key_compare const & comp = key_compare(),
+        Allocator const & alloc = Allocator(),
+        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    : _key_comp(comp), _value_comp(comp) { (void)alloc; insert(first, last); }
+
+    /// @brief Constructor by copy (3)
+    multimap (multimap const & m)
+    : _key_comp(m._key_comp), _value_comp(m._key_comp), _tree(m._tree) { }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (4)
+    multimap (multimap && m)
+    : _key_comp(m._key_comp), _value_comp(m._key_comp),
+      _tree(std::move(m._tree)) { }
+#endif
+
+    /****** Destructor ********************************************************/
+
+    ~multimap () { }
+
+    /****** Capacity **********************************************************/
+
+    bool empty () const
+    { return _tree.empty(); }
+
+    size_type size () const
+    { return _tree.size(); }
+
+    size_type max_size () const
+    { return _tree.get_allocator().max_size(); }
+
+    /****** Modifiers *********************************************************/
+
+    /// @brief Insert single element (1), after those of equivalent key
+    iterator insert (value_type const & val)
+    { return iterator(_tree.insert_equal(val), _tree.sentinel()); }
+
+    /// @brief Insert with hint (2), right before `position` if it fits there
+    iterator insert (iterator position, value_type const & val)
+    {
+        node_pointer p = _tree.insert_equal(position.current_node(), val);
+        return iterator(p, _tree.sentinel());
+    }
+
+    /// @brief Insert by iterator range (3)
+    template <class InputIterator>
+    void insert (InputIterator first, InputIterator last,
+    typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    { _tree.insert_range(first, last); }
+
+    /// @brief erase by iterator position (1)
+    void erase (iterator position)
+    { _tree.erase(position.current_node()); }
+
+    /// @brief erase by key (2)
+    /// @return Number of elements erased
+    size_type erase (key_type const & key)
+    { return _tree.erase(key); }
+
+    /// @brief erase by iterator range (3)
+    void erase (iterator first, iterator last)
+    { _tree.erase(first.current_node(), last.current_node()); }
+
+    void swap (multimap & m)
+    {
+        key_compare key_comp = _key_comp;
+        value_compare value_comp = _value_comp;
+
+        _key_comp = m._key_comp;
+        _value_comp = m._value_comp;
+        _tree.swap(m._tree);
+
+        m._key_comp = key_comp;
+        m._value_comp = value_comp;
+    }
+
+    void clear ()
+    { _tree.clear(); }
+
+    /****** Observers *********************************************************/
+
+    key_compare key_comp () const
+    { return _key_comp; }
+
+    value_compare value_comp () const
+    { return _value_comp; }
+
+    /****** Iterators *********************************************************/
+
+    iterator begin ()
+    { return iterator(_tree.leftmost(), _tree.sentinel()); }
+
+    const_iterator begin () const
+    { return const_iterator(_tree.leftmost(), _tree.sentinel()); }
+
+    iterator end ()
+    { return iterator(_tree.sentinel(), _tree.sentinel()); }
+
+    const_iterator end () const
+    { return const_iterator(_tree.sentinel(), _tree.sentinel()); }
+
+    reverse_iterator rbegin ()
+    { return reverse_iterator(end()); }
+
+    const_reverse_iterator rbegin () const
+    { return const_reverse_iterator(end()); }
+
+    reverse_iterator rend ()
+    { return reverse_iterator(begin()); }
+
+    const_reverse_iterator rend () const
+    { return const_reverse_iterator(begin()); }
+
+    /****** Operations ********************************************************/
+
+    /// @return First element of key `key`, or end
+    iterator find (key_type const & key)
+    { return _find<iterator>(key); }
+
+    const_iterator find (key_type const & key) const
+    { return _find<const_iterator>(key); }
+
+    /// @note O(log n + k) for k elements of key `key`
+    size_type count (key_type const & key) const
+    { return _tree.count(key); }
+
+    iterator lower_bound (key_type const & key)
+    { return iterator(_tree.lower_bound(key), _tree.sentinel()); }
+
+    const_iterator lower_bound (key_type const & key) const
+    { return const_iterator(_tree.lower_bound(key), _tree.sentinel()); }
+
+    iterator upper_bound (key_type const & key)
+    { return iterator(_tree.upper_bound(key), _tree.sentinel()); }
+
+    const_iterator upper_bound (key_type const & key) const
+    { return const_iterator(_tree.upper_bound(key), _tree.sentinel()); }
+
+    /// @note Both bounds in one descent, O(log n)
+    pair<iterator, iterator>
+    equal_range (key_type const & key)
+    { return _equal_range<iterator>(key); }
+
+    pair<const_iterator, const_iterator>
+    equal_range (key_type const & key) const
+    { return _equal_range<const_iterator>(key); }
+
+    /****** Heterogeneous lookup **********************************************/
+
+    /// @note Only with a transparent `Compare`, as for `map`.
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+    find (K const & key)
+    { return _find<iterator>(key); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+    find (K const & key) const
+    { return _find<const_iterator>(key); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, size_type>::type
+    count (K const & key) const
+    { return _tree.count(key); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+    lower_bound (K const & key)
+    { return iterator(_tree.lower_bound(key), _tree.sentinel()); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+    lower_bound (K const & key) const
+    { return const_iterator(_tree.lower_bound(key), _tree.sentinel()); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+    upper_bound (K const & key)
+    { return iterator(_tree.upper_bound(key), _tree.sentinel()); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, const_iterator>::type
+    upper_bound (K const & key) const
+    { return const_iterator(_tree.upper_bound(key), _tree.sentinel()); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K,
+                                      pair<iterator, iterator> >::type
+    equal_range (K const & key)
+    { return _equal_range<iterator>(key); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K,
+                                      pair<const_iterator, const_iterator> >::type
+    equal_range (K const & key) const
+    { return _equal_range<const_iterator>(key); }
+
+    /****** Miscellaneous *****************************************************/
+
+    allocator_type get_allocator () const
+    { return allocator_type(); }
+
+    multimap & operator= (multimap const & m)
+    {
+        _key_comp = m._key_comp;
+        _value_comp = m._value_comp;
+        _tree = m._tree;
+        return *this;
+    }
+
+#if __cplusplus >= 201103L
+    multimap & operator= (multimap && m)
+    {
+        _key_comp = m._key_comp;
+        _value_comp = m._value_comp;
+        _tree = std::move(m._tree);
+        return *this;
+    }
+#endif
+
+    /****** Internals *********************************************************/
+
+    private:
+
+    template <typename It, typename K>
+    It _find (K const & key) const
+    {
+        node_pointer p = _tree.find(key);
+        return It(p ? p : _tree.sentinel(), _tree.sentinel());
+    }
+
+    template <typename It, typename K>
+    pair<It, It> _equal_range (K const & key) const
+    {
+        pair<node_pointer, node_pointer> p = _tree.equal_range(key);
+        return pair<It, It>(It(p.first, _tree.sentinel()),
+                            It(p.second, _tree.sentinel()));
+    }
+};
+
+/******************************************************************************/
+/*                                                                            */
+/*      Non member functions                                                  */
+/*                                                                            */
+/******************************************************************************/
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator== (multimap<Key, T, Comp, Alloc> const & lhs,
+                 multimap<Key, T, Comp, Alloc> const & rhs)
+{
+    typename multimap<Key, T, Comp, Alloc>::const_iterator lit = lhs.begin();
+    typename multimap<Key, T, Comp, Alloc>::const_iterator rit = rhs.begin();
+
+    if (lhs.size() != rhs.size())
+        return false;
+    for (; lit != lhs.end() && *lit == *rit; lit++, rit++);
+    return lit == lhs.end();
+}
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator!= (multimap<Key, T, Comp, Alloc> const & lhs,
+                 multimap<Key, T, Comp, Alloc> const & rhs)
+{ return !(lhs == rhs); }
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+void swap (multimap<Key, T, Comp, Alloc> & lhs,
+           multimap<Key, T, Comp, Alloc> & rhs)
+{ lhs.swap(rhs); }
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator< (multimap<Key, T, Comp, Alloc> const & lhs,
+                multimap<Key, T, Comp, Alloc> const & rhs)
+{
+    return
+    lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator> (multimap<Key, T, Comp, Alloc> const & lhs,
+                multimap<Key, T, Comp, Alloc> const & rhs)
+{ return rhs < lhs; }
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator<= (multimap<Key, T, Comp, Alloc> const & lhs,
+                 multimap<Key, T, Comp, Alloc> const & rhs)
+{ return !(rhs < lhs); }
+
+template <typename Key, typename T, typename Comp, typename Alloc>
+bool operator>= (multimap<Key, T, Comp, Alloc> const & lhs,
+                 multimap<Key, T, Comp, Alloc> const & rhs)
+{ return !(lhs < rhs); }
+
+} // namespace
+
+#endif /* FT_MULTIMAP_HPP */
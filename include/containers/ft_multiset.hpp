@@ -0,0 +1,327 @@
+#ifndef FT_MULTISET_HPP
+#define FT_MULTISET_HPP 1
+
+#include <memory> // std::allocator
+#include <functional> // std::less
+#include <utility> // std::move
+
+#include "ft_pair.hpp"
+#include "rb_tree.hpp"
+#include "ft_rb_tree_iterator.hpp"
+#include "ft_reverse_iterator.hpp"
+#include "ft_lexicographical_compare.hpp"
+#include "ft_type_traits.hpp"
+
+namespace ft {
+
+/// @brief Sorted set of keys, equivalent keys allowed, as `std::multiset`
+/// @note Equivalent keys are stored side by side in insertion order.
+/// @note Elements are keys, so iterators are constant ones.
+/// @note Allocator won't be used. This multiset uses rb_tree allocator.
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>
+> class multiset
+{
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member types                                                      */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    typedef Key	                key_type;
+    typedef Key	                value_type;
+    typedef Compare	            key_compare;
+    typedef Compare	            value_compare;
+    typedef Allocator           allocator_type; // not used
+    typedef size_t              size_type;
+    typedef ptrdiff_t           difference_type;
+    typedef value_type &        reference;
+    typedef value_type const &  const_reference;
+    typedef value_type *        pointer;
+    typedef value_type const *  const_pointer;
+
+    private:
+
+    /// @note just some convenient typedefs
+    typedef rb_tree<Key, Compare, rb_no_augment, rb_equal_keys>
+                                                btree_type;
+    typedef typename btree_type::value_type     node_type;
+    typedef typename btree_type::value_type *   node_pointer;
+
+    public:
+
+    typedef rb_tree_iterator<node_type, value_type const>   iterator;
+    typedef rb_tree_iterator<node_type, value_type const>   const_iterator;
+
+    typedef ft::reverse_iterator<iterator>                  reverse_iterator;
+    typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Internal data                                                     */
+    /*                                                                        */
+    /**************************************************************************/
+
+    private:
+
+    key_compare     _comp;
+    btree_type      _tree;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member functions                                                  */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    /****** Constructors ******************************************************/
+
+    /// @brief Constructor by default (1)
+    explicit multiset (key_compare const & comp = key_compare(),
+                  Allocator const & alloc = Allocator())
+    : _comp(comp) { (void)alloc; }
+
+    /// @brief Constructor by range (2)
+    template <class InputIterator>
+    multiset (InputIterator first, InputIterator last,
+        key_compare const & comp = key_compare(),
+        Allocator const & alloc = Allocator(),
+        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    : _comp(comp) { (void)alloc; insert(first, last); }
+
+    /// @brief Constructor by copy (3)
+    multiset (multiset const & s)
+    : _comp(s._comp), _tree(s._tree) { }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (4)
+    multiset (multiset && s)
+    : _comp(s._comp), _tree(std::move(s._tree)) { }
+#endif
+
+    /****** Destructor ********************************************************/
+
+    ~multiset () { }
+
+    /****** Capacity **********************************************************/
+
+    bool empty () const
+    { return _tree.empty(); }
+
+    size_type size () const
+    { return _tree.size(); }
+
+    size_type max_size () const
+    { return _tree.get_allocator().max_size(); }
+
+    /****** Modifiers *********************************************************/
+
+    /// @brief Insert single element (1), after the equivalent ones
+    iterator insert (value_type const & val)
+    { return iterator(_tree.insert_equal(val), _tree.sentinel()); }
+
+    /// @brief Insert with hint (2), right before `position` if it fits there
+    iterator insert (iterator position, value_type const & val)
+    {
+        node_pointer p = _tree.insert_equal(position.current_node(), val);
+        return iterator(p, _tree.sentinel());
+    }
+
+    /// @brief Insert by iterator range (3)
+    template <class InputIterator>
+    void insert (InputIterator first, InputIterator last,
+    typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    { _tree.insert_range(first, last); }
+
+    /// @brief erase by iterator position (1)
+    void erase (iterator position)
+    { _tree.erase(position.current_node()); }
+
+    /// @brief erase by key (2)
+    /// @return Number of elements erased
+    size_type erase (key_type const & key)
+    { return _tree.erase(key); }
+
+    /// @brief erase by iterator range (3)
+    void erase (iterator first, iterator last)
+    { _tree.erase(first.current_node(), last.current_node()); }
+
+    void swap (multiset & s)
+    {
+        key_compare comp = _comp;
+
+        _comp = s._comp;
+        s._comp = comp;
+        _tree.swap(s._tree);
+    }
+
+    void clear ()
+    { _tree.clear(); }
+
+    /****** Observers *********************************************************/
+
+    key_compare key_comp () const
+    { return _comp; }
+
+    value_compare value_comp () const
+    { return _comp; }
+
+    /****** Iterators *********************************************************/
+
+    iterator begin () const
+    { return iterator(_tree.leftmost(), _tree.sentinel()); }
+
+    iterator end () const
+    { return iterator(_tree.sentinel(), _tree.sentinel()); }
+
+    reverse_iterator rbegin () const
+    { return reverse_iterator(end()); }
+
+    reverse_iterator rend () const
+    { return reverse_iterator(begin()); }
+
+    /****** Operations ********************************************************/
+
+    /// @return First element equivalent to `key`, or end
+    iterator find (key_type const & key) const
+    {
+        node_pointer p = _tree.find(key);
+        return p ? iterator(p, _tree.sentinel()) : end();
+    }
+
+    /// @note O(log n + k) for k elements equivalent to `key`
+    size_type count (key_type const & key) const
+    { return _tree.count(key); }
+
+    iterator lower_bound (key_type const & key) const
+    { return iterator(_tree.lower_bound(key), _tree.sentinel()); }
+
+    iterator upper_bound (key_type const & key) const
+    { return iterator(_tree.upper_bound(key), _tree.sentinel()); }
+
+    /// @note Both bounds in one descent, O(log n)
+    pair<iterator, iterator> equal_range (key_type const & key) const
+    {
+        pair<node_pointer, node_pointer> p = _tree.equal_range(key);
+        return pair<iterator, iterator>(iterator(p.first, _tree.sentinel()),
+                                        iterator(p.second, _tree.sentinel()));
+    }
+
+    /****** Heterogeneous lookup **********************************************/
+
+    /// @note Only with a transparent `Compare`, one declaring an
+    ///       `is_transparent` type: `key` is any type it compares with
+    ///       `key_type`, so lookups build no `key_type`.
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+    find (K const & key) const
+    {
+        node_pointer p = _tree.find(key);
+        return p ? iterator(p, _tree.sentinel()) : end();
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, size_type>::type
+    count (K const & key) const
+    { return _tree.count(key); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+    lower_bound (K const & key) const
+    { return iterator(_tree.lower_bound(key), _tree.sentinel()); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+    upper_bound (K const & key) const
+    { return iterator(_tree.upper_bound(key), _tree.sentinel()); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K,
+                                      pair<iterator, iterator> >::type
+    equal_range (K const & key) const
+    {
+        pair<node_pointer, node_pointer> p = _tree.equal_range(key);
+        return pair<iterator, iterator>(iterator(p.first, _tree.sentinel()),
+                                        iterator(p.second, _tree.sentinel()));
+    }
+
+    /****** Miscellaneous *****************************************************/
+
+    allocator_type get_allocator () const
+    { return allocator_type(); }
+
+    multiset & operator= (multiset const & s)
+    {
+        _comp = s._comp;
+        _tree = s._tree;
+        return *this;
+    }
+
+#if __cplusplus >= 201103L
+    multiset & operator= (multiset && s)
+    {
+        _comp = s._comp;
+        _tree = std::move(s._tree);
+        return *this;
+    }
+#endif
+};
+
+/******************************************************************************/
+/*                                                                            */
+/*      Non member functions                                                  */
+/*                                                                            */
+/******************************************************************************/
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator== (multiset<Key, Comp, Alloc> const & lhs,
+                 multiset<Key, Comp, Alloc> const & rhs)
+{
+    typename multiset<Key, Comp, Alloc>::const_iterator lit = lhs.begin();
+    typename multiset<Key, Comp, Alloc>::const_iterator rit = rhs.begin();
+
+    if (lhs.size() != rhs.size())
+        return false;
+    for (; lit != lhs.end() && *lit == *rit; lit++, rit++);
+    return lit == lhs.end();
+}
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator!= (multiset<Key, Comp, Alloc> const & lhs,
+                 multiset<Key, Comp, Alloc> const & rhs)
+{ return !(lhs == rhs); }
+
+template <typename Key, typename Comp, typename Alloc>
+void swap (multiset<Key, Comp, Alloc> & lhs, multiset<Key, Comp, Alloc> & rhs)
+{ lhs.swap(rhs); }
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator< (multiset<Key, Comp, Alloc> const & lhs,
+                multiset<Key, Comp, Alloc> const & rhs)
+{
+    return
+    lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator> (multiset<Key, Comp, Alloc> const & lhs,
+                multiset<Key, Comp, Alloc> const & rhs)
+{ return rhs < lhs; }
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator<= (multiset<Key, Comp, Alloc> const & lhs,
+                 multiset<Key, Comp, Alloc> const & rhs)
+{ return !(rhs < lhs); }
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator>= (multiset<Key, Comp, Alloc> const & lhs,
+                 multiset<Key, Comp, Alloc> const & rhs)
+{ return !(lhs < rhs); }
+
+} // namespace
+
+#endif /* FT_MULTISET_HPP */
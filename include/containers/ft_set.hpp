@@ -0,0 +1,325 @@
+#ifndef FT_SET_HPP
+#define FT_SET_HPP 1
+
+#include <memory> // std::allocator
+#include <functional> // std::less
+#include <utility> // std::move
+
+#include "ft_pair.hpp"
+#include "rb_tree.hpp"
+#include "ft_rb_tree_iterator.hpp"
+#include "ft_reverse_iterator.hpp"
+#include "ft_lexicographical_compare.hpp"
+#include "ft_type_traits.hpp"
+
+namespace ft {
+
+/// @brief Sorted set of unique keys, as `std::set`
+/// @note Elements are keys, so iterators are constant ones.
+/// @note Allocator won't be used. This set uses rb_tree allocator.
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>
+> class set
+{
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member types                                                      */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    typedef Key	                key_type;
+    typedef Key	                value_type;
+    typedef Compare	            key_compare;
+    typedef Compare	            value_compare;
+    typedef Allocator           allocator_type; // not used
+    typedef size_t              size_type;
+    typedef ptrdiff_t           difference_type;
+    typedef value_type &        reference;
+    typedef value_type const &  const_reference;
+    typedef value_type *        pointer;
+    typedef value_type const *  const_pointer;
+
+    private:
+
+    /// @note just some convenient typedefs
+    typedef rb_tree<Key, Compare>               btree_type;
+    typedef typename btree_type::value_type     node_type;
+    typedef typename btree_type::value_type *   node_pointer;
+
+    public:
+
+    typedef rb_tree_iterator<node_type, value_type const>   iterator;
+    typedef rb_tree_iterator<node_type, value_type const>   const_iterator;
+
+    typedef ft::reverse_iterator<iterator>                  reverse_iterator;
+    typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Internal data                                                     */
+    /*                                                                        */
+    /**************************************************************************/
+
+    private:
+
+    key_compare     _comp;
+    btree_type      _tree;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member functions                                                  */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    /****** Constructors ******************************************************/
+
+    /// @brief Constructor by default (1)
+    explicit set (key_compare const & comp = key_compare(),
+                  Allocator const & alloc = Allocator())
+    : _comp(comp) { (void)alloc; }
+
+    /// @brief Constructor by range (2)
+    template <class InputIterator>
+    set (InputIterator first, InputIterator last,
+        key_compare const & comp = key_compare(),
+        Allocator const & alloc = Allocator(),
+        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    : _comp(comp) { (void)alloc; insert(first, last); }
+
+    /// @brief Constructor by copy (3)
+    set (set const & s)
+    : _comp(s._comp), _tree(s._tree) { }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (4)
+    set (set && s)
+    : _comp(s._comp), _tree(std::move(s._tree)) { }
+#endif
+
+    /****** Destructor ********************************************************/
+
+    ~set () { }
+
+    /****** Capacity **********************************************************/
+
+    bool empty () const
+    { return _tree.empty(); }
+
+    size_type size () const
+    { return _tree.size(); }
+
+    size_type max_size () const
+    { return _tree.get_allocator().max_size(); }
+
+    /****** Modifiers *********************************************************/
+
+    /// @brief Insert single element (1)
+    pair<iterator, bool> insert (value_type const & val)
+    {
+        pair<node_pointer, bool> p = _tree.insert_unique(val);
+        return pair<iterator, bool>(iterator(p.first, _tree.sentinel()), p.second);
+    }
+
+    /// @brief Insert with hint (2)
+    iterator insert (iterator position, value_type const & val)
+    {
+        node_pointer p = _tree.insert_unique(position.current_node(), val).first;
+        return iterator(p, _tree.sentinel());
+    }
+
+    /// @brief Insert by iterator range (3)
+    template <class InputIterator>
+    void insert (InputIterator first, InputIterator last,
+    typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    { _tree.insert_range(first, last); }
+
+    /// @brief erase by iterator position (1)
+    void erase (iterator position)
+    { _tree.erase(position.current_node()); }
+
+    /// @brief erase by key (2)
+    /// @return 1 if `key` was found and erased, 0 otherwise
+    size_type erase (key_type const & key)
+    { return _tree.erase(key); }
+
+    /// @brief erase by iterator range (3)
+    void erase (iterator first, iterator last)
+    { _tree.erase(first.current_node(), last.current_node()); }
+
+    void swap (set & s)
+    {
+        key_compare comp = _comp;
+
+        _comp = s._comp;
+        s._comp = comp;
+        _tree.swap(s._tree);
+    }
+
+    void clear ()
+    { _tree.clear(); }
+
+    /****** Observers *********************************************************/
+
+    key_compare key_comp () const
+    { return _comp; }
+
+    value_compare value_comp () const
+    { return _comp; }
+
+    /****** Iterators *********************************************************/
+
+    iterator begin () const
+    { return iterator(_tree.leftmost(), _tree.sentinel()); }
+
+    iterator end () const
+    { return iterator(_tree.sentinel(), _tree.sentinel()); }
+
+    reverse_iterator rbegin () const
+    { return reverse_iterator(end()); }
+
+    reverse_iterator rend () const
+    { return reverse_iterator(begin()); }
+
+    /****** Operations ********************************************************/
+
+    iterator find (key_type const & key) const
+    {
+        node_pointer p = _tree.find(key);
+        return p ? iterator(p, _tree.sentinel()) : end();
+    }
+
+    size_type count (key_type const & key) const
+    { return find(key) == end() ? 0 : 1; }
+
+    iterator lower_bound (key_type const & key) const
+    { return iterator(_tree.lower_bound(key), _tree.sentinel()); }
+
+    iterator upper_bound (key_type const & key) const
+    { return iterator(_tree.upper_bound(key), _tree.sentinel()); }
+
+    pair<iterator, iterator> equal_range (key_type const & key) const
+    {
+        pair<node_pointer, node_pointer> p = _tree.equal_range(key);
+        return pair<iterator, iterator>(iterator(p.first, _tree.sentinel()),
+                                        iterator(p.second, _tree.sentinel()));
+    }
+
+    /****** Heterogeneous lookup **********************************************/
+
+    /// @note Only with a transparent `Compare`, one declaring an
+    ///       `is_transparent` type: `key` is any type it compares with
+    ///       `key_type`, so lookups build no `key_type`.
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+    find (K const & key) const
+    {
+        node_pointer p = _tree.find(key);
+        return p ? iterator(p, _tree.sentinel()) : end();
+    }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, size_type>::type
+    count (K const & key) const
+    { return find(key) == end() ? 0 : 1; }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+    lower_bound (K const & key) const
+    { return iterator(_tree.lower_bound(key), _tree.sentinel()); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K, iterator>::type
+    upper_bound (K const & key) const
+    { return iterator(_tree.upper_bound(key), _tree.sentinel()); }
+
+    template <typename K>
+    typename ft::enable_if_transparent<Compare, K,
+                                      pair<iterator, iterator> >::type
+    equal_range (K const & key) const
+    {
+        pair<node_pointer, node_pointer> p = _tree.equal_range(key);
+        return pair<iterator, iterator>(iterator(p.first, _tree.sentinel()),
+                                        iterator(p.second, _tree.sentinel()));
+    }
+
+    /****** Miscellaneous *****************************************************/
+
+    allocator_type get_allocator () const
+    { return allocator_type(); }
+
+    set & operator= (set const & s)
+    {
+        _comp = s._comp;
+        _tree = s._tree;
+        return *this;
+    }
+
+#if __cplusplus >= 201103L
+    set & operator= (set && s)
+    {
+        _comp = s._comp;
+        _tree = std::move(s._tree);
+        return *this;
+    }
+#endif
+};
+
+/******************************************************************************/
+/*                                                                            */
+/*      Non member functions                                                  */
+/*                                                                            */
+/******************************************************************************/
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator== (set<Key, Comp, Alloc> const & lhs,
+                 set<Key, Comp, Alloc> const & rhs)
+{
+    typename set<Key, Comp, Alloc>::const_iterator lit = lhs.begin();
+    typename set<Key, Comp, Alloc>::const_iterator rit = rhs.begin();
+
+    if (lhs.size() != rhs.size())
+        return false;
+    for (; lit != lhs.end() && *lit == *rit; lit++, rit++);
+    return lit == lhs.end();
+}
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator!= (set<Key, Comp, Alloc> const & lhs,
+                 set<Key, Comp, Alloc> const & rhs)
+{ return !(lhs == rhs); }
+
+template <typename Key, typename Comp, typename Alloc>
+void swap (set<Key, Comp, Alloc> & lhs, set<Key, Comp, Alloc> & rhs)
+{ lhs.swap(rhs); }
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator< (set<Key, Comp, Alloc> const & lhs,
+                set<Key, Comp, Alloc> const & rhs)
+{
+    return
+    lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator> (set<Key, Comp, Alloc> const & lhs,
+                set<Key, Comp, Alloc> const & rhs)
+{ return rhs < lhs; }
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator<= (set<Key, Comp, Alloc> const & lhs,
+                 set<Key, Comp, Alloc> const & rhs)
+{ return !(rhs < lhs); }
+
+template <typename Key, typename Comp, typename Alloc>
+bool operator>= (set<Key, Comp, Alloc> const & lhs,
+                 set<Key, Comp, Alloc> const & rhs)
+{ return !(lhs < rhs); }
+
+} // namespace
+
+#endif /* FT_SET_HPP */
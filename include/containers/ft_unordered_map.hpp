@@ -0,0 +1,301 @@
+#ifndef FT_UNORDERED_MAP_HPP
+#define FT_UNORDERED_MAP_HPP 1
+
+#include <memory> // std::allocator
+#include <functional> // std::equal_to
+#include <utility> // std::move
+
+#include "ft_pair.hpp"
+#include "ft_hash.hpp"
+#include "hash_table.hpp"
+#include "ft_type_traits.hpp"
+
+namespace ft {
+
+/// @brief Unordered associative container of unique keys, as
+///        `std::unordered_map`, stored in an open addressing hash table
+/// @note Elements live in one array of slots probed 16 at a time, see
+///       `hash_table`. Inserting may rehash, which invalidates iterators and
+///       moves elements; erasing invalidates the erased element only.
+/// @note `max_load_factor` is at most 1: each slot holds a single element.
+template <typename Key, typename T, typename Hash = ft::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<pair<Key const, T> >
+> class unordered_map
+{
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member types                                                      */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    typedef Key	                        key_type;
+    typedef T	                        mapped_type;
+    typedef pair<Key const, T>	        value_type;
+    typedef Hash                        hasher;
+    typedef KeyEqual                    key_equal;
+    typedef Allocator                   allocator_type;
+    typedef size_t                      size_type;
+    typedef ptrdiff_t                   difference_type;
+    typedef value_type &                reference;
+    typedef value_type const &          const_reference;
+    typedef value_type *                pointer;
+    typedef value_type const *          const_pointer;
+
+    private:
+
+    typedef hash_table<Key, value_type, hash_select_first<value_type>,
+                       Hash, KeyEqual, Allocator>       table_type;
+
+    public:
+
+    typedef typename table_type::iterator               iterator;
+    typedef typename table_type::const_iterator         const_iterator;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Internal data                                                     */
+    /*                                                                        */
+    /**************************************************************************/
+
+    private:
+
+    table_type      _table;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member functions                                                  */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    /****** Constructors ******************************************************/
+
+    /// @brief Constructor by default (1)
+    explicit unordered_map (size_type bucket_count = 0,
+                            hasher const & hash = hasher(),
+                            key_equal const & eq = key_equal(),
+                            Allocator const & alloc = Allocator())
+    : _table(bucket_count, hash, eq, alloc) { }
+
+    /// @brief Constructor by range (2)
+    template <class InputIterator>
+    unordered_map (InputIterator first, InputIterator last,
+        size_type bucket_count = 0,
+        hasher const & hash = hasher(),
+        key_equal const & eq = key_equal(),
+        Allocator const & alloc = Allocator(),
+        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    : _table(bucket_count, hash, eq, alloc)
+    { _table.insert_range(first, last); }
+
+    /// @brief Constructor by copy (3)
+    unordered_map (unordered_map const & m)
+    : _table(m._table) { }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (4)
+    unordered_map (unordered_map && m)
+    : _table(std::move(m._table)) { }
+#endif
+
+    /****** Destructor ********************************************************/
+
+    ~unordered_map () { }
+
+    /****** Element access ****************************************************/
+
+    mapped_type & operator[] (key_type const & key)
+    {
+        iterator it = _table.find(key);
+
+        if (it == end())
+            it = _table.insert_unique(value_type(key, mapped_type())).first;
+        return it->second;
+    }
+
+    /****** Capacity **********************************************************/
+
+    bool empty () const
+    { return _table.empty(); }
+
+    size_type size () const
+    { return _table.size(); }
+
+    size_type max_size () const
+    { return _table.max_size(); }
+
+    /****** Modifiers *********************************************************/
+
+    /// @brief Insert single element (1)
+    pair<iterator, bool> insert (value_type const & val)
+    { return _table.insert_unique(val); }
+
+    /// @brief Insert with hint (2)
+    /// @note The hint is useless to a hash table
+    iterator insert (const_iterator position, value_type const & val)
+    { (void)position; return _table.insert_unique(val).first; }
+
+    /// @brief Insert by iterator range (3)
+    template <class InputIterator>
+    void insert (InputIterator first, InputIterator last,
+    typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    { _table.insert_range(first, last); }
+
+    /// @brief erase by iterator position (1)
+    void erase (const_iterator position)
+    { _table.erase(position); }
+
+    /// @brief erase by key (2)
+    /// @return 1 if `key` was found and erased, 0 otherwise
+    size_type erase (key_type const & key)
+    { return _table.erase(key); }
+
+    /// @brief erase by iterator range (3)
+    void erase (const_iterator first, const_iterator last)
+    { _table.erase(first, last); }
+
+    void swap (unordered_map & m)
+    { _table.swap(m._table); }
+
+    void clear ()
+    { _table.clear(); }
+
+    /****** Iterators *********************************************************/
+
+    iterator begin ()
+    { return _table.begin(); }
+
+    const_iterator begin () const
+    { return _table.begin(); }
+
+    iterator end ()
+    { return _table.end(); }
+
+    const_iterator end () const
+    { return _table.end(); }
+
+    /****** Lookup ************************************************************/
+
+    iterator find (key_type const & key)
+    { return _table.find(key); }
+
+    const_iterator find (key_type const & key) const
+    { return _table.find(key); }
+
+    size_type count (key_type const & key) const
+    { return find(key) == end() ? 0 : 1; }
+
+    pair<iterator, iterator>
+    equal_range (key_type const & key)
+    {
+        iterator first = find(key);
+        iterator last = first;
+
+        if (last != end())
+            ++last;
+        return pair<iterator, iterator>(first, last);
+    }
+
+    pair<const_iterator, const_iterator>
+    equal_range (key_type const & key) const
+    {
+        const_iterator first = find(key);
+        const_iterator last = first;
+
+        if (last != end())
+            ++last;
+        return pair<const_iterator, const_iterator>(first, last);
+    }
+
+    /****** Hash policy *******************************************************/
+
+    /// @note Slots are the buckets of an open addressing table
+    size_type bucket_count () const
+    { return _table.bucket_count(); }
+
+    float load_factor () const
+    { return _table.load_factor(); }
+
+    float max_load_factor () const
+    { return _table.max_load_factor(); }
+
+    /// @note Clamped to 1 at most
+    void max_load_factor (float ml)
+    { _table.max_load_factor(ml); }
+
+    void rehash (size_type count)
+    { _table.rehash(count); }
+
+    void reserve (size_type count)
+    { _table.reserve(count); }
+
+    /****** Observers *********************************************************/
+
+    hasher hash_function () const
+    { return _table.hash_function(); }
+
+    key_equal key_eq () const
+    { return _table.key_eq(); }
+
+    /****** Miscellaneous *****************************************************/
+
+    allocator_type get_allocator () const
+    { return _table.get_allocator(); }
+
+    unordered_map & operator= (unordered_map const & m)
+    {
+        _table = m._table;
+        return *this;
+    }
+
+#if __cplusplus >= 201103L
+    unordered_map & operator= (unordered_map && m)
+    {
+        _table = std::move(m._table);
+        return *this;
+    }
+#endif
+};
+
+/******************************************************************************/
+/*                                                                            */
+/*      Non member functions                                                  */
+/*                                                                            */
+/******************************************************************************/
+
+/// @note Same elements whatever their order: each one is looked up in `rhs`
+template <typename Key, typename T, typename Hash, typename Eq, typename Alloc>
+bool operator== (unordered_map<Key, T, Hash, Eq, Alloc> const & lhs,
+                 unordered_map<Key, T, Hash, Eq, Alloc> const & rhs)
+{
+    typedef typename unordered_map<Key, T, Hash, Eq, Alloc>::const_iterator
+                                                            const_iterator;
+
+    if (lhs.size() != rhs.size())
+        return false;
+    for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+    {
+        const_iterator found = rhs.find(it->first);
+        if (found == rhs.end() || !(found->second == it->second))
+            return false;
+    }
+    return true;
+}
+
+template <typename Key, typename T, typename Hash, typename Eq, typename Alloc>
+bool operator!= (unordered_map<Key, T, Hash, Eq, Alloc> const & lhs,
+                 unordered_map<Key, T, Hash, Eq, Alloc> const & rhs)
+{ return !(lhs == rhs); }
+
+template <typename Key, typename T, typename Hash, typename Eq, typename Alloc>
+void swap (unordered_map<Key, T, Hash, Eq, Alloc> & lhs,
+           unordered_map<Key, T, Hash, Eq, Alloc> & rhs)
+{ lhs.swap(rhs); }
+
+} // namespace
+
+#endif /* FT_UNORDERED_MAP_HPP */
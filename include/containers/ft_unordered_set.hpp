@@ -0,0 +1,266 @@
+#ifndef FT_UNORDERED_SET_HPP
+#define FT_UNORDERED_SET_HPP 1
+
+#include <memory> // std::allocator
+#include <functional> // std::equal_to
+#include <utility> // std::move
+
+#include "ft_pair.hpp"
+#include "ft_hash.hpp"
+#include "hash_table.hpp"
+#include "ft_type_traits.hpp"
+
+namespace ft {
+
+/// @brief Unordered set of unique keys stored in an open addressing hash
+///        table, see `unordered_map`
+/// @note Elements are keys, so iterators are constant ones.
+template <typename Key, typename Hash = ft::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<Key>
+> class unordered_set
+{
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member types                                                      */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    typedef Key	                        key_type;
+    typedef Key	                        value_type;
+    typedef Hash                        hasher;
+    typedef KeyEqual                    key_equal;
+    typedef Allocator                   allocator_type;
+    typedef size_t                      size_type;
+    typedef ptrdiff_t                   difference_type;
+    typedef value_type &                reference;
+    typedef value_type const &          const_reference;
+    typedef value_type *                pointer;
+    typedef value_type const *          const_pointer;
+
+    private:
+
+    typedef hash_table<Key, Key, hash_identity<Key>,
+                       Hash, KeyEqual, Allocator>       table_type;
+
+    public:
+
+    typedef typename table_type::const_iterator         iterator;
+    typedef typename table_type::const_iterator         const_iterator;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Internal data                                                     */
+    /*                                                                        */
+    /**************************************************************************/
+
+    private:
+
+    table_type      _table;
+
+    /**************************************************************************/
+    /*                                                                        */
+    /*      Member functions                                                  */
+    /*                                                                        */
+    /**************************************************************************/
+
+    public:
+
+    /****** Constructors ******************************************************/
+
+    /// @brief Constructor by default (1)
+    explicit unordered_set (size_type bucket_count = 0,
+                            hasher const & hash = hasher(),
+                            key_equal const & eq = key_equal(),
+                            Allocator const & alloc = Allocator())
+    : _table(bucket_count, hash, eq, alloc) { }
+
+    /// @brief Constructor by range (2)
+    template <class InputIterator>
+    unordered_set (InputIterator first, InputIterator last,
+        size_type bucket_count = 0,
+        hasher const & hash = hasher(),
+        key_equal const & eq = key_equal(),
+        Allocator const & alloc = Allocator(),
+        typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    : _table(bucket_count, hash, eq, alloc)
+    { _table.insert_range(first, last); }
+
+    /// @brief Constructor by copy (3)
+    unordered_set (unordered_set const & s)
+    : _table(s._table) { }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (4)
+    unordered_set (unordered_set && s)
+    : _table(std::move(s._table)) { }
+#endif
+
+    /****** Destructor ********************************************************/
+
+    ~unordered_set () { }
+
+    /****** Capacity **********************************************************/
+
+    bool empty () const
+    { return _table.empty(); }
+
+    size_type size () const
+    { return _table.size(); }
+
+    size_type max_size () const
+    { return _table.max_size(); }
+
+    /****** Modifiers *********************************************************/
+
+    /// @brief Insert single element (1)
+    pair<iterator, bool> insert (value_type const & val)
+    {
+        pair<typename table_type::iterator, bool> res =
+            _table.insert_unique(val);
+        return pair<iterator, bool>(res.first, res.second);
+    }
+
+    /// @brief Insert with hint (2)
+    /// @note The hint is useless to a hash table
+    iterator insert (const_iterator position, value_type const & val)
+    { (void)position; return _table.insert_unique(val).first; }
+
+    /// @brief Insert by iterator range (3)
+    template <class InputIterator>
+    void insert (InputIterator first, InputIterator last,
+    typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = 0)
+    { _table.insert_range(first, last); }
+
+    /// @brief erase by iterator position (1)
+    void erase (const_iterator position)
+    { _table.erase(position); }
+
+    /// @brief erase by key (2)
+    /// @return 1 if `key` was found and erased, 0 otherwise
+    size_type erase (key_type const & key)
+    { return _table.erase(key); }
+
+    /// @brief erase by iterator range (3)
+    void erase (const_iterator first, const_iterator last)
+    { _table.erase(first, last); }
+
+    void swap (unordered_set & s)
+    { _table.swap(s._table); }
+
+    void clear ()
+    { _table.clear(); }
+
+    /****** Iterators *********************************************************/
+
+    iterator begin () const
+    { return _table.begin(); }
+
+    iterator end () const
+    { return _table.end(); }
+
+    /****** Lookup ************************************************************/
+
+    iterator find (key_type const & key) const
+    { return _table.find(key); }
+
+    size_type count (key_type const & key) const
+    { return find(key) == end() ? 0 : 1; }
+
+    pair<iterator, iterator>
+    equal_range (key_type const & key) const
+    {
+        iterator first = find(key);
+        iterator last = first;
+
+        if (last != end())
+            ++last;
+        return pair<iterator, iterator>(first, last);
+    }
+
+    /****** Hash policy *******************************************************/
+
+    /// @note Slots are the buckets of an open addressing table
+    size_type bucket_count () const
+    { return _table.bucket_count(); }
+
+    float load_factor () const
+    { return _table.load_factor(); }
+
+    float max_load_factor () const
+    { return _table.max_load_factor(); }
+
+    /// @note Clamped to 1 at most
+    void max_load_factor (float ml)
+    { _table.max_load_factor(ml); }
+
+    void rehash (size_type count)
+    { _table.rehash(count); }
+
+    void reserve (size_type count)
+    { _table.reserve(count); }
+
+    /****** Observers *********************************************************/
+
+    hasher hash_function () const
+    { return _table.hash_function(); }
+
+    key_equal key_eq () const
+    { return _table.key_eq(); }
+
+    /****** Miscellaneous *****************************************************/
+
+    allocator_type get_allocator () const
+    { return _table.get_allocator(); }
+
+    unordered_set & operator= (unordered_set const & s)
+    {
+        _table = s._table;
+        return *this;
+    }
+
+#if __cplusplus >= 201103L
+    unordered_set & operator= (unordered_set && s)
+    {
+        _table = std::move(s._table);
+        return *this;
+    }
+#endif
+};
+
+/******************************************************************************/
+/*                                                                            */
+/*      Non member functions                                                  */
+/*                                                                            */
+/******************************************************************************/
+
+template <typename Key, typename Hash, typename Eq, typename Alloc>
+bool operator== (unordered_set<Key, Hash, Eq, Alloc> const & lhs,
+                 unordered_set<Key, Hash, Eq, Alloc> const & rhs)
+{
+    typedef typename unordered_set<Key, Hash, Eq, Alloc>::const_iterator
+                                                            const_iterator;
+
+    if (lhs.size() != rhs.size())
+        return false;
+    for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+        if (rhs.find(*it) == rhs.end())
+            return false;
+    return true;
+}
+
+template <typename Key, typename Hash, typename Eq, typename Alloc>
+bool operator!= (unordered_set<Key, Hash, Eq, Alloc> const & lhs,
+                 unordered_set<Key, Hash, Eq, Alloc> const & rhs)
+{ return !(lhs == rhs); }
+
+template <typename Key, typename Hash, typename Eq, typename Alloc>
+void swap (unordered_set<Key, Hash, Eq, Alloc> & lhs,
+           unordered_set<Key, Hash, Eq, Alloc> & rhs)
+{ lhs.swap(rhs); }
+
+} // namespace
+
+#endif /* FT_UNORDERED_SET_HPP */
@@ -438,9 +438,9 @@ class vector {
        difference_type start = first - begin();
        difference_type finish = last - begin();
 
-       // 2. Copy elements than can be copied
+       // 2. Shift elements of [last, end) down to first
        difference_type i = finish;
-       while (i < static_cast<difference_type>(_size) && start < finish)
+       while (i < static_cast<difference_type>(_size))
            _data[start++] = _data[i++];
 
        // 3. Destroy elements not copied to [first, last) until end
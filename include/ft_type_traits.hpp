@@ -15,6 +15,14 @@ namespace ft {
     template <class T>
     struct enable_if<true, T> { typedef T type; };
 
+    /****** conditional *******************************************************/
+
+    template <bool B, class T, class F>
+    struct conditional { typedef T type; };
+
+    template <class T, class F>
+    struct conditional<false, T, F> { typedef F type; };
+
     /****** remove_const ******************************************************/
 
     template <class T>
@@ -70,6 +78,58 @@ namespace ft {
     /// @note 'signed char' is a different type than 'char'
     template <> struct is_integral<signed char> : public is_integral<char> {};
 
+    /****** is_trivially_destructible *****************************************/
+
+    /// @brief Whether destroying a `T` does nothing at all
+    /// @note The compiler alone knows. This builtin, known to GCC and Clang
+    ///       in C++98 too, is what their own C++11 trait relies on.
+    template <class T>
+    struct is_trivially_destructible
+    : public integral_constant<bool, __has_trivial_destructor(T)> { };
+
+    /****** is_transparent ****************************************************/
+
+    /// @brief Whether comparison `T` declares an `is_transparent` type, that
+    ///        is compares keys with any type it accepts, not only `key_type`
+    template <class T>
+    struct is_transparent
+    {
+        private:
+
+        typedef char yes;
+        typedef struct { char c[2]; } no;
+
+        template <class U> static yes test (typename U::is_transparent *);
+        template <class U> static no test (...);
+
+        public:
+
+        static const bool value = sizeof(test<T>(0)) == sizeof(yes);
+    };
+
+    /// @brief `enable_if` on a transparent `Compare`, for lookups of `K` keys
+    /// @note Naming `K` makes the test depend on the member template argument,
+    ///       so a non transparent `Compare` discards the overload instead of
+    ///       failing the whole class.
+    template <class Compare, class K, class R>
+    struct enable_if_transparent
+    : public enable_if<is_transparent<Compare>::value, R> { };
+
+#if __cplusplus >= 201103L
+    /****** index_sequence ****************************************************/
+
+    /// @brief Compile time list of indexes, to unpack tuples (as C++14's)
+    template <size_t... I>
+    struct index_sequence { };
+
+    /// @brief `index_sequence<0, 1, ..., N - 1>`
+    template <size_t N, size_t... I>
+    struct make_index_sequence : public make_index_sequence<N - 1, N - 1, I...> { };
+
+    template <size_t... I>
+    struct make_index_sequence<0, I...> : public index_sequence<I...> { };
+#endif
+
 } // namespace ft
 
 #endif /* FT_TYPE_TRAITS_HPP */
@@ -0,0 +1,147 @@
+#ifndef BTREE_ITERATOR_HPP
+#define BTREE_ITERATOR_HPP 1
+
+#include <stddef.h> // NULL, size_t
+
+#include "ft_iterator_base_types.hpp"
+#include "ft_type_traits.hpp"
+
+namespace ft
+{
+
+/// @brief Bidirectional iterator over the values of a btree, in order
+/// @note An iterator is a node and a position in it. end() is one past the
+///       last value of the rightmost leaf. Inserting or erasing moves values
+///       between nodes, so it invalidates every iterator of the tree.
+template <typename Node, typename U>
+class btree_iterator : public iterator<bidirectional_iterator_tag, U>
+{
+    public:
+
+    typedef iterator_traits<btree_iterator>     traits; // to shorten below
+    typedef typename traits::iterator_category  iterator_category;
+    typedef typename traits::value_type         value_type;
+    typedef typename traits::difference_type    difference_type;
+    typedef typename traits::pointer	        pointer;
+    typedef typename traits::reference	        reference;
+    typedef Node *                              node_pointer;
+
+    private:
+
+    node_pointer _node;
+    size_t _position;
+
+    public:
+
+    /// @brief Constructor by default
+    btree_iterator (node_pointer node = NULL, size_t position = 0)
+    : _node(node), _position(position)
+    { }
+
+    /// @brief Constructor by copy from mutable iterator
+    btree_iterator (btree_iterator<Node, typename ft::remove_const<value_type>::type> const & it)
+    : _node(it.node()), _position(it.position())
+    { }
+
+    /// @brief Constructor by copy from const iterator
+    btree_iterator (btree_iterator<Node, typename ft::add_const<value_type>::type> const & it)
+    : _node(it.node()), _position(it.position())
+    { }
+
+    btree_iterator & operator= (btree_iterator const & it)
+    {
+        _node = it.node();
+        _position = it.position();
+        return *this;
+    }
+
+    reference operator* () const
+    { return _node->values()[_position]; }
+
+    pointer operator-> () const
+    { return _node->values() + _position; }
+
+    bool operator== (btree_iterator const & it) const
+    { return _node == it.node() && _position == it.position(); }
+
+    bool operator!= (btree_iterator const & it) const
+    { return !(*this == it); }
+
+    /// @brief prefix incerement
+    btree_iterator & operator++ ()
+    {
+        // case 1: next value is the min of the subtree on our right
+        if (!_node->leaf)
+        {
+            _node = _node->child(_position + 1);
+            while (!_node->leaf)
+                _node = _node->child(0);
+            _position = 0;
+            return *this;
+        }
+
+        // case 2: next value in the same leaf
+        if (++_position < _node->count)
+            return *this;
+
+        // case 3: first parent value we reach from its left, or end if we
+        //         climb from the max value
+        btree_iterator end = *this;
+        while (_position == _node->count)
+        {
+            if (_node->parent == NULL)
+                return *this = end;
+            _position = _node->position;
+            _node = _node->parent;
+        }
+        return *this;
+    }
+
+    /// @brief prefix decerement
+    btree_iterator & operator-- ()
+    {
+        // case 1: previous value is the max of the subtree on our left
+        if (!_node->leaf)
+        {
+            _node = _node->child(_position);
+            while (!_node->leaf)
+                _node = _node->child(_node->count);
+            _position = _node->count - 1;
+            return *this;
+        }
+
+        // case 2: previous value in the same leaf
+        if (_position > 0)
+        {
+            --_position;
+            return *this;
+        }
+
+        // case 3: first parent value we reach from its right
+        while (_position == 0 && _node->parent != NULL)
+        {
+            _position = _node->position;
+            _node = _node->parent;
+        }
+        --_position;
+        return *this;
+    }
+
+    /// @brief postfix incerement
+    btree_iterator operator++ (int)
+    { btree_iterator tmp = *this; this->operator++(); return tmp; }
+
+    /// @brief postfix decerement
+    btree_iterator operator-- (int)
+    { btree_iterator tmp = *this; this->operator--(); return tmp; }
+
+    node_pointer node () const
+    { return _node; }
+
+    size_t position () const
+    { return _position; }
+};
+
+} // namespace
+
+#endif /* BTREE_ITERATOR_HPP */
@@ -0,0 +1,110 @@
+#ifndef HASH_TABLE_ITERATOR_HPP
+#define HASH_TABLE_ITERATOR_HPP 1
+
+#include <stddef.h> // NULL
+
+#include "ft_iterator_base_types.hpp"
+#include "ft_type_traits.hpp"
+
+namespace ft
+{
+
+/// @brief Control byte of a hash table slot: a full slot holds 7 bits of its
+///        value hash (0 to 127), other states are negative
+enum hash_ctrl
+{
+    hash_ctrl_empty = -128,
+    hash_ctrl_deleted = -2,
+    hash_ctrl_sentinel = -1 // one past the last slot, stops iterators
+};
+
+/// @brief Forward iterator over the full slots of a hash_table
+/// @note An iterator walks control bytes and slots side by side, skipping
+///       slots that are not full until the sentinel byte.
+template <typename U>
+class hash_table_iterator : public iterator<forward_iterator_tag, U>
+{
+    public:
+
+    typedef iterator_traits<hash_table_iterator> traits; // to shorten below
+    typedef typename traits::iterator_category  iterator_category;
+    typedef typename traits::value_type         value_type;
+    typedef typename traits::difference_type    difference_type;
+    typedef typename traits::pointer	        pointer;
+    typedef typename traits::reference	        reference;
+    typedef typename ft::remove_const<U>::type  slot_type;
+
+    private:
+
+    signed char const * _ctrl;
+    slot_type * _slot;
+
+    public:
+
+    /// @brief Constructor by default
+    hash_table_iterator (signed char const * ctrl = NULL, slot_type * slot = NULL)
+    : _ctrl(ctrl), _slot(slot)
+    { }
+
+    /// @brief Constructor by copy from mutable iterator
+    hash_table_iterator (hash_table_iterator<slot_type> const & it)
+    : _ctrl(it.ctrl()), _slot(it.slot())
+    { }
+
+    /// @brief Constructor by copy from const iterator
+    hash_table_iterator (hash_table_iterator<slot_type const> const & it)
+    : _ctrl(it.ctrl()), _slot(it.slot())
+    { }
+
+    hash_table_iterator & operator= (hash_table_iterator const & it)
+    {
+        _ctrl = it.ctrl();
+        _slot = it.slot();
+        return *this;
+    }
+
+    reference operator* () const
+    { return *_slot; }
+
+    pointer operator-> () const
+    { return _slot; }
+
+    bool operator== (hash_table_iterator const & it) const
+    { return _ctrl == it.ctrl(); }
+
+    bool operator!= (hash_table_iterator const & it) const
+    { return !(*this == it); }
+
+    /// @brief Move to the first full slot from here, or to the sentinel
+    hash_table_iterator & skip_empty_slots ()
+    {
+        while (*_ctrl < 0 && *_ctrl != hash_ctrl_sentinel)
+        {
+            ++_ctrl;
+            ++_slot;
+        }
+        return *this;
+    }
+
+    /// @brief prefix incerement
+    hash_table_iterator & operator++ ()
+    {
+        ++_ctrl;
+        ++_slot;
+        return skip_empty_slots();
+    }
+
+    /// @brief postfix incerement
+    hash_table_iterator operator++ (int)
+    { hash_table_iterator tmp = *this; this->operator++(); return tmp; }
+
+    signed char const * ctrl () const
+    { return _ctrl; }
+
+    slot_type * slot () const
+    { return _slot; }
+};
+
+} // namespace
+
+#endif /* HASH_TABLE_ITERATOR_HPP */
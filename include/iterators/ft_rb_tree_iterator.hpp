@@ -0,0 +1,158 @@
+#ifndef RB_TREE_ITERATOR_HPP
+#define RB_TREE_ITERATOR_HPP 1
+
+#include <stddef.h> // NULL
+
+#include "ft_iterator_base_types.hpp"
+#include "ft_type_traits.hpp"
+
+namespace ft
+{
+
+/// @brief Bidirectional iterator over the nodes of an rb_tree, in order
+/// @param Node rb_tree node type, whose `key` is the value iterated over
+/// @param U Value type, const qualified for const iterators
+/// @note Holding the sentinel makes end() decrementable and lets containers
+///       built on rb_tree share this iterator. Links are followed through
+///       it too, as they may be indexes into the tree node slabs.
+template <typename Node, typename U>
+class rb_tree_iterator : public iterator<bidirectional_iterator_tag, U>
+{
+    public:
+
+    typedef iterator_traits<rb_tree_iterator>   traits; // to shorten below
+    typedef typename traits::iterator_category  iterator_category;
+    typedef typename traits::value_type         value_type;
+    typedef typename traits::difference_type    difference_type;
+    typedef typename traits::pointer	        pointer;
+    typedef typename traits::reference	        reference;
+    typedef Node *                              node_pointer;
+
+    private:
+
+    node_pointer _current;
+    node_pointer _sentinel;
+
+    node_pointer _left (node_pointer x) const
+    { return Node::left(x, _sentinel); }
+
+    node_pointer _right (node_pointer x) const
+    { return Node::right(x, _sentinel); }
+
+    node_pointer _parent (node_pointer x) const
+    { return Node::parent(x, _sentinel); }
+
+    public:
+
+    /// @brief Constructor by default
+    rb_tree_iterator (node_pointer current = NULL, node_pointer sentinel = NULL)
+    :_current(current), _sentinel(sentinel)
+    { }
+
+    /// @brief Constructor by copy from mutable iterator
+    rb_tree_iterator (rb_tree_iterator<Node, typename ft::remove_const<value_type>::type> const & it)
+    : _current(it.current_node()),
+     _sentinel(const_cast<node_pointer>(it.sentinel_node()))
+    { }
+
+    /// @brief Constructor by copy from const iterator
+    rb_tree_iterator (rb_tree_iterator<Node, typename ft::add_const<value_type>::type> const & it)
+    : _current(const_cast<node_pointer>(it.current_node())),
+     _sentinel(const_cast<node_pointer>(it.sentinel_node()))
+    { }
+
+    rb_tree_iterator operator= (rb_tree_iterator const & it)
+    {
+        _current = it.current_node();
+        _sentinel = it.sentinel_node();
+        return *this;
+    }
+
+    reference operator* () const
+    { return _current->key; }
+
+    pointer operator-> () const
+    { return &_current->key; }
+
+    bool operator== (rb_tree_iterator const & it) const
+    { return _current == it.current_node(); }
+
+    bool operator!= (rb_tree_iterator const & it) const
+    { return !(*this == it); }
+
+    /// @brief prefix incerement
+    rb_tree_iterator & operator++ ()
+    {
+        // case 1: next node is min(_current->right)
+        if (_right(_current) != _sentinel)
+        {
+            _current = _right(_current);
+            while (_left(_current) != _sentinel)
+                _current = _left(_current);
+            return *this;
+        }
+
+        // case 2: next node is the first parent we reach from its left
+        //         subtree, or the sentinel if we climb from the max node
+        node_pointer p = _parent(_current);
+        while (p != _sentinel && _current == _right(p))
+        {
+            _current = p;
+            p = _parent(p);
+        }
+        _current = p;
+
+        return *this;
+    }
+
+    /// @brief prefix decerement
+    rb_tree_iterator & operator-- ()
+    {
+        // case 0: previous node is the max one, cached as the sentinel
+        //         right child
+        if (_current == _sentinel)
+        {
+            _current = _right(_current);
+            return *this;
+        }
+
+        // case 1: previous node is max(_current->left)
+        if (_left(_current) != _sentinel)
+        {
+            _current = _left(_current);
+            while (_right(_current) != _sentinel)
+                _current = _right(_current);
+            return *this;
+        }
+
+        // case 2: previous node is the first parent we reach from its
+        //         right subtree, or the sentinel if we climb from the min
+        node_pointer p = _parent(_current);
+        while (p != _sentinel && _current == _left(p))
+        {
+            _current = p;
+            p = _parent(p);
+        }
+        _current = p;
+
+        return *this;
+    }
+
+    /// @brief postfix incerement
+    rb_tree_iterator operator++ (int)
+    { rb_tree_iterator tmp = *this; this->operator++(); return tmp; }
+
+    /// @brief postfix decerement
+    rb_tree_iterator operator-- (int)
+    { rb_tree_iterator tmp = *this; this->operator--(); return tmp; }
+
+    node_pointer current_node () const
+    { return _current; }
+
+    node_pointer sentinel_node () const
+    { return _sentinel; }
+};
+
+} // namespace
+
+#endif /* RB_TREE_ITERATOR_HPP */
@@ -0,0 +1,750 @@
+#ifndef BTREE_HPP
+#define BTREE_HPP 1
+
+#include <stddef.h> // NULL
+#include <memory> // std::allocator
+#include <functional> // std::less
+#include <algorithm> // std::swap
+
+#if __cplusplus >= 201103L
+# include <utility> // std::move
+#endif
+
+#include "ft_pair.hpp"
+#include "ft_btree_iterator.hpp"
+
+namespace ft {
+
+/****** Key extraction ********************************************************/
+
+/// @brief Key of a map element
+template <typename Pair>
+struct btree_select_first
+{
+    typename Pair::first_type const & operator() (Pair const & p) const
+    { return p.first; }
+};
+
+/// @brief Key of a set element
+template <typename T>
+struct btree_identity
+{
+    T const & operator() (T const & x) const
+    { return x; }
+};
+
+/****** Raw storage alignment *************************************************/
+
+/// @brief Alignment of `T`, as the padding `T` gets after a single char
+template <typename T>
+struct btree_alignment_of
+{
+    struct probe { char c; T t; };
+    enum { value = sizeof(probe) - sizeof(T) };
+};
+
+/// @brief Type aligned as `Align` bytes, to align raw storage of values
+template <size_t Align> struct btree_aligner { typedef long double type; };
+template <> struct btree_aligner<1> { typedef char type; };
+template <> struct btree_aligner<2> { typedef short type; };
+template <> struct btree_aligner<4> { typedef int type; };
+template <> struct btree_aligner<8> { typedef double type; };
+
+/****** B-tree ****************************************************************/
+
+/**
+ *  @brief B-tree of unique keys, values being stored in every node
+ *  @param KeyOfValue Functor returning the key of a value
+ *  @param Allocator Rebound to the values, and to both kinds of nodes
+ *  @param NodeBytes Target size of a leaf node. Values are packed in sorted
+ *         arrays of that size, so a lookup touches O(log n / log B) nodes,
+ *         each of a few contiguous cache lines, instead of one node per
+ *         level of a binary tree.
+ *  @note Every node but the root holds between `min_values` and
+ *        `max_values` values, internal nodes one child more than values.
+ *  @note Values are moved between slots as nodes fill and empty (copied
+ *        before C++11): moving, or copying, a value must not throw.
+ */
+template <typename Key, typename Value, typename KeyOfValue,
+          typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Value>, size_t NodeBytes = 256>
+class btree
+{
+    /****** Types *************************************************************/
+
+    public:
+
+    typedef Key                 key_type;
+    typedef Value               value_type;
+    typedef Compare             key_compare;
+    typedef size_t              size_type;
+
+    private:
+
+    typedef typename btree_aligner<
+        btree_alignment_of<Value>::value>::type aligner_type;
+
+    enum
+    {
+        header_bytes = 2 * sizeof(void *),
+        fit_values = (NodeBytes - header_bytes) / sizeof(Value),
+        max_values = fit_values < 3 ? 3 : fit_values,
+        min_values = (max_values - 1) / 2,
+        raw_size = (max_values * sizeof(Value) + sizeof(aligner_type) - 1)
+                   / sizeof(aligner_type)
+    };
+
+    struct internal_node; // forward declaration
+
+    struct node
+    {
+        node * parent;
+        unsigned short position; // index in parent children
+        unsigned short count; // number of values
+        bool leaf;
+        aligner_type raw[raw_size];
+
+        Value * values ()
+        { return reinterpret_cast<Value *>(raw); }
+
+        Value const * values () const
+        { return reinterpret_cast<Value const *>(raw); }
+
+        /// @pre Internal node
+        node *& child (size_type i)
+        { return static_cast<internal_node *>(this)->children[i]; }
+    };
+
+    struct internal_node : public node
+    {
+        node * children[max_values + 1];
+    };
+
+    public:
+
+    typedef node                                    node_type;
+    typedef btree_iterator<node, Value>             iterator;
+    typedef btree_iterator<node, Value const>       const_iterator;
+    typedef typename Allocator::template rebind<Value>::other
+                                                    allocator_type;
+
+    private:
+
+    typedef typename Allocator::template rebind<node>::other
+                                                    leaf_allocator_type;
+    typedef typename Allocator::template rebind<internal_node>::other
+                                                    internal_allocator_type;
+
+    /****** Data **************************************************************/
+
+    allocator_type  _alloc;
+    key_compare     _comp;
+    KeyOfValue      _key;
+    node *          _root;
+    node *          _leftmost; // first leaf, for begin()
+    node *          _rightmost; // last leaf, for end()
+    size_type       _size;
+
+    /****** Nodes *************************************************************/
+
+    node * _create_node (bool leaf)
+    {
+        node * n;
+
+        if (leaf)
+            n = leaf_allocator_type(_alloc).allocate(1);
+        else
+            n = internal_allocator_type(_alloc).allocate(1);
+        n->parent = NULL;
+        n->position = 0;
+        n->count = 0;
+        n->leaf = leaf;
+        return n;
+    }
+
+    /// @brief Deallocate a node whose values are already destroyed
+    void _destroy_node (node * n)
+    {
+        if (n->leaf)
+            leaf_allocator_type(_alloc).deallocate(n, 1);
+        else
+            internal_allocator_type(_alloc).deallocate(
+                static_cast<internal_node *>(n), 1);
+    }
+
+    /// @brief Destroy subtree `n`, values included
+    void _destroy (node * n)
+    {
+        if (n == NULL)
+            return;
+        if (!n->leaf)
+            for (size_type i = 0; i <= n->count; i++)
+                _destroy(n->child(i));
+        for (size_type i = 0; i < n->count; i++)
+            _alloc.destroy(n->values() + i);
+        _destroy_node(n);
+    }
+
+    /// @return Deep copy of subtree `n`, hung on `parent`
+    node * _copy (node const * n, node * parent)
+    {
+        node * c = _create_node(n->leaf);
+
+        c->parent = parent;
+        c->position = n->position;
+        for (; c->count < n->count; c->count++)
+            _alloc.construct(c->values() + c->count, n->values()[c->count]);
+        if (!n->leaf)
+            for (size_type i = 0; i <= n->count; i++)
+                c->child(i) = _copy(const_cast<node *>(n)->child(i), c);
+        return c;
+    }
+
+    /// @brief Set `c` as child `i` of internal node `n`
+    static void _set_child (node * n, size_type i, node * c)
+    {
+        n->child(i) = c;
+        c->parent = n;
+        c->position = static_cast<unsigned short>(i);
+    }
+
+#if __cplusplus >= 201103L
+    static Value && _moved (Value & v)
+    { return std::move(v); }
+#else
+    static Value const & _moved (Value & v)
+    { return v; }
+#endif
+
+    /// @brief Move-construct value `src` into raw slot `dst`, destroying
+    ///        `src`
+    void _move_value (Value * dst, Value * src)
+    {
+        _alloc.construct(dst, _moved(*src));
+        _alloc.destroy(src);
+    }
+
+    /// @brief Make room for a value at `i` in node `n`, with `right` as child
+    ///        `i + 1` if `n` is internal
+    /// @return Raw slot `i`, left for the caller to construct and count
+    /// @pre `n` is not full
+    Value * _open_value (node * n, size_type i, node * right)
+    {
+        for (size_type j = n->count; j > i; j--)
+            _move_value(n->values() + j, n->values() + j - 1);
+        if (!n->leaf)
+        {
+            for (size_type j = n->count + 1; j > i + 1; j--)
+                _set_child(n, j, n->child(j - 1));
+            _set_child(n, i + 1, right);
+        }
+        return n->values() + i;
+    }
+
+    /// @brief Insert a copy of `v` at `i` in node `n`
+    void _insert_value (node * n, size_type i, Value const & v, node * right)
+    {
+        _alloc.construct(_open_value(n, i, right), v);
+        n->count++;
+    }
+
+    /// @brief Move `v` to `i` in node `n`
+    void _insert_moved (node * n, size_type i, Value & v, node * right)
+    {
+        _alloc.construct(_open_value(n, i, right), _moved(v));
+        n->count++;
+    }
+
+    /// @brief Erase value `i` of node `n`, with child `i + 1` if `n` is
+    ///        internal
+    void _erase_value (node * n, size_type i)
+    {
+        _alloc.destroy(n->values() + i);
+        for (size_type j = i + 1; j < n->count; j++)
+            _move_value(n->values() + j - 1, n->values() + j);
+        if (!n->leaf)
+            for (size_type j = i + 2; j <= n->count; j++)
+                _set_child(n, j - 1, n->child(j));
+        n->count--;
+    }
+
+    /// @brief Split full node `n`: its upper half goes to new node `right`
+    ///        and its median value is returned, out of both
+    Value _split (node * n, node *& right)
+    {
+        size_type s = max_values / 2;
+
+        right = _create_node(n->leaf);
+        if (n == _rightmost)
+            _rightmost = right;
+        for (size_type j = s + 1; j < n->count; j++)
+            _move_value(right->values() + j - s - 1, n->values() + j);
+        if (!n->leaf)
+            for (size_type j = s + 1; j <= n->count; j++)
+                _set_child(right, j - s - 1, n->child(j));
+        right->count = static_cast<unsigned short>(n->count - s - 1);
+
+        Value median(_moved(n->values()[s]));
+        _alloc.destroy(n->values() + s);
+        n->count = static_cast<unsigned short>(s);
+        return median;
+    }
+
+    /// @brief Insert separator `median` and its right subtree `right`, split
+    ///        from `n`, into the parent of `n`, splitting it in turn if full
+    void _insert_up (node * n, Value & median, node * right)
+    {
+        node * p = n->parent;
+        size_type pos = n->position;
+        node * p_right = NULL;
+
+        if (p == NULL)
+        {
+            _root = _create_node(false);
+            _alloc.construct(_root->values(), _moved(median));
+            _root->count = 1;
+            _set_child(_root, 0, n);
+            _set_child(_root, 1, right);
+            return;
+        }
+        if (p->count < max_values)
+            return _insert_moved(p, pos, median, right);
+        Value p_median = _split(p, p_right);
+        if (pos <= p->count)
+            _insert_moved(p, pos, median, right);
+        else
+            _insert_moved(p_right, pos - p->count - 1, median, right);
+        _insert_up(p, p_median, p_right);
+    }
+
+    /// @brief Insert `v` at position `i` of leaf `n`, splitting full nodes
+    ///        on the way up
+    /// @return Position of the new value
+    iterator _insert_leaf (node * n, size_type i, Value const & v)
+    {
+        iterator it;
+        node * right = NULL;
+
+        _size++;
+        if (n->count < max_values)
+        {
+            _insert_value(n, i, v, NULL);
+            return iterator(n, i);
+        }
+        Value median = _split(n, right);
+        if (i <= n->count)
+        {
+            _insert_value(n, i, v, NULL);
+            it = iterator(n, i);
+        }
+        else
+        {
+            _insert_value(right, i - n->count - 1, v, NULL);
+            it = iterator(right, i - n->count - 1);
+        }
+        _insert_up(n, median, right);
+        return it;
+    }
+
+    /// @brief Refill node `n` that went under `min_values` values, borrowing
+    ///        from a sibling or merging with one, up to the root
+    void _rebalance (node * n)
+    {
+        while (n != _root && n->count < min_values)
+        {
+            node * p = n->parent;
+            size_type pos = n->position;
+            node * left = pos > 0 ? p->child(pos - 1) : NULL;
+            node * right = pos < p->count ? p->child(pos + 1) : NULL;
+
+            if (left && left->count > min_values)
+                return _rotate_right(p, pos - 1);
+            if (right && right->count > min_values)
+                return _rotate_left(p, pos);
+            _merge(p, left ? pos - 1 : pos);
+            n = p;
+        }
+        if (_root->count == 0)
+        {
+            node * old = _root;
+            if (_root->leaf)
+                _root = _leftmost = _rightmost = NULL;
+            else
+            {
+                _root = _root->child(0);
+                _root->parent = NULL;
+                _root->position = 0;
+            }
+            _destroy_node(old);
+        }
+    }
+
+    /// @brief Move the last value of child `k` of `p` up, and separator `k`
+    ///        down to the front of child `k + 1`
+    void _rotate_right (node * p, size_type k)
+    {
+        node * left = p->child(k);
+        node * right = p->child(k + 1);
+        node * moved = left->leaf ? NULL : left->child(left->count);
+
+        for (size_type j = right->count; j > 0; j--)
+            _move_value(right->values() + j, right->values() + j - 1);
+        _move_value(right->values(), p->values() + k);
+        if (!right->leaf)
+        {
+            for (size_type j = right->count + 1; j > 0; j--)
+                _set_child(right, j, right->child(j - 1));
+            _set_child(right, 0, moved);
+        }
+        right->count++;
+        _move_value(p->values() + k, left->values() + left->count - 1);
+        left->count--;
+    }
+
+    /// @brief Move the first value of child `k + 1` of `p` up, and separator
+    ///        `k` down to the back of child `k`
+    void _rotate_left (node * p, size_type k)
+    {
+        node * left = p->child(k);
+        node * right = p->child(k + 1);
+
+        _move_value(left->values() + left->count, p->values() + k);
+        if (!left->leaf)
+            _set_child(left, left->count + 1, right->child(0));
+        left->count++;
+        _move_value(p->values() + k, right->values());
+        for (size_type j = 1; j < right->count; j++)
+            _move_value(right->values() + j - 1, right->values() + j);
+        if (!right->leaf)
+            for (size_type j = 1; j <= right->count; j++)
+                _set_child(right, j - 1, right->child(j));
+        right->count--;
+    }
+
+    /// @brief Merge child `k + 1` of `p` and separator `k` into child `k`
+    void _merge (node * p, size_type k)
+    {
+        node * left = p->child(k);
+        node * right = p->child(k + 1);
+        size_type n = left->count;
+
+        _move_value(left->values() + n, p->values() + k);
+        for (size_type j = 0; j < right->count; j++)
+            _move_value(left->values() + n + 1 + j, right->values() + j);
+        if (!left->leaf)
+            for (size_type j = 0; j <= right->count; j++)
+                _set_child(left, n + 1 + j, right->child(j));
+        left->count = static_cast<unsigned short>(n + 1 + right->count);
+        if (right == _rightmost)
+            _rightmost = left;
+        _destroy_node(right);
+        // the separator slot of `p` has been moved out already
+        for (size_type j = k + 1; j < p->count; j++)
+            _move_value(p->values() + j - 1, p->values() + j);
+        for (size_type j = k + 2; j <= p->count; j++)
+            _set_child(p, j - 1, p->child(j));
+        p->count--;
+    }
+
+    /// @return First position of node `n` whose key is not less than `key`
+    size_type _lower (node const * n, key_type const & key) const
+    {
+        size_type lo = 0;
+        size_type hi = n->count;
+
+        while (lo < hi)
+        {
+            size_type mid = (lo + hi) / 2;
+            if (_comp(_key(n->values()[mid]), key))
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    }
+
+    /// @return First position of node `n` whose key is greater than `key`
+    size_type _upper (node const * n, key_type const & key) const
+    {
+        size_type lo = 0;
+        size_type hi = n->count;
+
+        while (lo < hi)
+        {
+            size_type mid = (lo + hi) / 2;
+            if (_comp(key, _key(n->values()[mid])))
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+        return lo;
+    }
+
+    /// @brief Find the first and last leaves again, after a deep copy
+    void _reset_bounds ()
+    {
+        _leftmost = _root;
+        while (_leftmost && !_leftmost->leaf)
+            _leftmost = _leftmost->child(0);
+        _rightmost = _root;
+        while (_rightmost && !_rightmost->leaf)
+            _rightmost = _rightmost->child(_rightmost->count);
+    }
+
+    /****** Public methods ****************************************************/
+
+    public:
+
+    /// @brief Constructor by default (1)
+    /// @param alloc Allocator of every value and node
+    explicit btree (key_compare const & comp = key_compare(),
+                    allocator_type const & alloc = allocator_type())
+    : _alloc(alloc), _comp(comp), _root(NULL),
+      _leftmost(NULL), _rightmost(NULL), _size(0) { }
+
+    /// @brief Constructor by copy (2)
+    /// @note The allocator is copied along, as the values are.
+    btree (btree const & t)
+    : _alloc(t._alloc), _comp(t._comp), _root(NULL),
+      _leftmost(NULL), _rightmost(NULL), _size(0)
+    { *this = t; }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (3)
+    btree (btree && t)
+    : _alloc(t._alloc), _comp(t._comp), _root(NULL),
+      _leftmost(NULL), _rightmost(NULL), _size(0)
+    { swap(t); }
+#endif
+
+    ~btree ()
+    { _destroy(_root); }
+
+    btree & operator= (btree const & rhs)
+    {
+        if (this == &rhs)
+            return *this;
+        clear();
+        _comp = rhs._comp;
+        if (rhs._root)
+            _root = _copy(rhs._root, NULL);
+        _reset_bounds();
+        _size = rhs._size;
+        return *this;
+    }
+
+#if __cplusplus >= 201103L
+    btree & operator= (btree && rhs)
+    {
+        if (this == &rhs)
+            return *this;
+        clear();
+        swap(rhs);
+        return *this;
+    }
+#endif
+
+    /****** Iterators *********************************************************/
+
+    iterator begin ()
+    { return iterator(_leftmost, 0); }
+
+    const_iterator begin () const
+    { return const_iterator(_leftmost, 0); }
+
+    iterator end ()
+    { return iterator(_rightmost, _rightmost ? _rightmost->count : 0); }
+
+    const_iterator end () const
+    { return const_iterator(_rightmost, _rightmost ? _rightmost->count : 0); }
+
+    /****** Capacity **********************************************************/
+
+    bool empty () const
+    { return _size == 0; }
+
+    size_type size () const
+    { return _size; }
+
+    size_type max_size () const
+    { return leaf_allocator_type(_alloc).max_size(); }
+
+    /****** Modifiers *********************************************************/
+
+    /// @brief Insert `v` unless a value of equivalent key is already there
+    /// @note Single descent: the equivalent value, if any, is the first one
+    ///       not less than the key on the path to the leaf.
+    pair<iterator, bool> insert_unique (Value const & v)
+    {
+        node * n = _root;
+        size_type i;
+
+        if (n == NULL)
+        {
+            _root = _leftmost = _rightmost = _create_node(true);
+            return pair<iterator, bool>(_insert_leaf(_root, 0, v), true);
+        }
+        while (1)
+        {
+            i = _lower(n, _key(v));
+            if (i < n->count && !_comp(_key(v), _key(n->values()[i])))
+                return pair<iterator, bool>(iterator(n, i), false);
+            if (n->leaf)
+                break;
+            n = n->child(i);
+        }
+        return pair<iterator, bool>(_insert_leaf(n, i, v), true);
+    }
+
+    /// @brief Insert `v`, in O(1) when it goes after the max and the hint is
+    ///        end, as for sorted loads
+    iterator insert_unique (const_iterator hint, Value const & v)
+    {
+        if (hint == end() && _size)
+        {
+            node * n = _rightmost;
+            if (_comp(_key(n->values()[n->count - 1]), _key(v)))
+                return _insert_leaf(n, n->count, v);
+        }
+        return insert_unique(v).first;
+    }
+
+    template <typename InputIterator>
+    void insert_range (InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+            insert_unique(end(), *first);
+    }
+
+    /// @brief Erase value at `position`
+    /// @note An internal value is replaced by its predecessor, always in a
+    ///       leaf, so only leaves lose values.
+    void erase (iterator position)
+    {
+        node * n = position.node();
+        size_type i = position.position();
+
+        if (!n->leaf)
+        {
+            node * l = n->child(i);
+            while (!l->leaf)
+                l = l->child(l->count);
+            _alloc.destroy(n->values() + i);
+            _alloc.construct(n->values() + i,
+                             _moved(l->values()[l->count - 1]));
+            n = l;
+            i = l->count - 1;
+        }
+        _erase_value(n, i);
+        _size--;
+        _rebalance(n);
+    }
+
+    /// @return Number of values erased (0 or 1)
+    size_type erase (key_type const & key)
+    {
+        iterator it = find(key);
+        if (it == end())
+            return 0;
+        erase(it);
+        return 1;
+    }
+
+    /// @brief Erase values in [first, last)
+    /// @note Erasing invalidates iterators: each step looks the next value up
+    ///       again from the key of the erased one.
+    void erase (iterator first, iterator last)
+    {
+        size_type n = 0;
+
+        if (first == begin() && last == end())
+            return clear();
+        for (iterator it = first; it != last; ++it)
+            n++;
+        while (n--)
+        {
+            key_type key = _key(*first);
+            erase(first);
+            first = lower_bound(key);
+        }
+    }
+
+    void clear ()
+    {
+        _destroy(_root);
+        _root = _leftmost = _rightmost = NULL;
+        _size = 0;
+    }
+
+    /// @note The allocators are exchanged too, as the nodes must go back to
+    ///       their own.
+    void swap (btree & t)
+    {
+        std::swap(_alloc, t._alloc);
+        std::swap(_comp, t._comp);
+        std::swap(_root, t._root);
+        std::swap(_leftmost, t._leftmost);
+        std::swap(_rightmost, t._rightmost);
+        std::swap(_size, t._size);
+    }
+
+    allocator_type get_allocator () const
+    { return _alloc; }
+
+    /****** Lookup ************************************************************/
+
+    key_compare key_comp () const
+    { return _comp; }
+
+    iterator find (key_type const & key)
+    {
+        iterator it = lower_bound(key);
+        return it != end() && !_comp(key, _key(*it)) ? it : end();
+    }
+
+    const_iterator find (key_type const & key) const
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !_comp(key, _key(*it)) ? it : end();
+    }
+
+    /// @note The answer is the last candidate met on the way down: the first
+    ///       value not less than `key` in the lowest node that has one.
+    iterator lower_bound (key_type const & key) const
+    {
+        node * n = _root;
+        iterator it = end();
+
+        while (n)
+        {
+            size_type i = _lower(n, key);
+            if (i < n->count)
+                it = iterator(n, i);
+            if (n->leaf)
+                break;
+            n = n->child(i);
+        }
+        return it;
+    }
+
+    iterator upper_bound (key_type const & key) const
+    {
+        node * n = _root;
+        iterator it = end();
+
+        while (n)
+        {
+            size_type i = _upper(n, key);
+            if (i < n->count)
+                it = iterator(n, i);
+            if (n->leaf)
+                break;
+            n = n->child(i);
+        }
+        return it;
+    }
+};
+
+} // namespace
+
+#endif /* BTREE_HPP */
@@ -0,0 +1,67 @@
+#ifndef FT_HASH_HPP
+#define FT_HASH_HPP 1
+
+#include <stddef.h> // size_t
+#include <string>
+
+namespace ft {
+
+/// @brief Hash functor, as std::hash which c++98 lacks
+/// @note Only the types specialized below are hashable, as for std::hash.
+///       Integers hash to themselves: hash tables are expected to mix bits.
+template <typename T>
+struct hash;
+
+#define FT_HASH_IDENTITY(T)                                                    \
+template <>                                                                    \
+struct hash<T>                                                                 \
+{                                                                              \
+    size_t operator() (T x) const                                              \
+    { return static_cast<size_t>(x); }                                         \
+};
+
+FT_HASH_IDENTITY(bool)
+FT_HASH_IDENTITY(char)
+FT_HASH_IDENTITY(signed char)
+FT_HASH_IDENTITY(unsigned char)
+FT_HASH_IDENTITY(wchar_t)
+FT_HASH_IDENTITY(short)
+FT_HASH_IDENTITY(unsigned short)
+FT_HASH_IDENTITY(int)
+FT_HASH_IDENTITY(unsigned int)
+FT_HASH_IDENTITY(long)
+FT_HASH_IDENTITY(unsigned long)
+#if __cplusplus >= 201103L
+FT_HASH_IDENTITY(long long)
+FT_HASH_IDENTITY(unsigned long long)
+#endif
+
+#undef FT_HASH_IDENTITY
+
+template <typename T>
+struct hash<T *>
+{
+    size_t operator() (T * p) const
+    { return reinterpret_cast<size_t>(p); }
+};
+
+/// @note FNV-1a over the characters
+template <>
+struct hash<std::string>
+{
+    size_t operator() (std::string const & s) const
+    {
+        size_t h = 2166136261u;
+
+        for (std::string::size_type i = 0; i < s.size(); i++)
+        {
+            h ^= static_cast<unsigned char>(s[i]);
+            h *= 16777619u;
+        }
+        return h;
+    }
+};
+
+} // namespace
+
+#endif /* FT_HASH_HPP */
@@ -3,6 +3,13 @@
 
 #include <iostream> // ???
 
+#if __cplusplus >= 201103L
+# include <tuple> // std::tuple, std::piecewise_construct_t
+# include <utility> // std::move
+#endif
+
+#include "ft_type_traits.hpp"
+
 namespace ft {
 
 template <typename T1, typename T2>
@@ -44,6 +51,23 @@ struct pair
     /// @brief Constructor by initialization (3)
     pair(first_type const & a, second_type const & b) : first(a), second(b) { }
 
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move, with same type
+    /// @note A const member can't be moved from: it is copied.
+    pair(pair<T1,T2> && pair)
+    : first(std::move(pair.first)), second(std::move(pair.second)) { }
+#endif
+
+#if __cplusplus >= 201103L
+    /// @brief Piecewise constructor (4): each member is constructed in place
+    ///        from its own tuple of arguments, as `std::pair`'s
+    template <typename... Args1, typename... Args2>
+    pair(std::piecewise_construct_t,
+         std::tuple<Args1...> a, std::tuple<Args2...> b)
+    : pair(a, b, make_index_sequence<sizeof...(Args1)>(),
+                 make_index_sequence<sizeof...(Args2)>()) { }
+#endif
+
     pair & operator=(pair const & pair)
     {
         first = pair.first;
@@ -51,6 +75,16 @@ struct pair
         return *this;
     }
 
+#if __cplusplus >= 201103L
+    private:
+
+    /// @note `std::get` on a moved tuple yields each argument with its own
+    ///       value category, so rvalues are forwarded and lvalues are not.
+    template <typename Tuple1, typename Tuple2, size_t... I1, size_t... I2>
+    pair(Tuple1 & a, Tuple2 & b, index_sequence<I1...>, index_sequence<I2...>)
+    : first(std::get<I1>(std::move(a))...),
+      second(std::get<I2>(std::move(b))...) { }
+#endif
 };
 
 /****** Non-member functions overload *****************************************/
@@ -0,0 +1,601 @@
+#ifndef HASH_TABLE_HPP
+#define HASH_TABLE_HPP 1
+
+#include <stddef.h> // NULL
+#include <memory> // std::allocator
+#include <algorithm> // std::swap
+#include <functional> // std::equal_to
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+#include "ft_pair.hpp"
+#include "ft_hash.hpp"
+#include "ft_hash_table_iterator.hpp"
+
+namespace ft {
+
+/// @brief Key of a map element
+template <typename Pair>
+struct hash_select_first
+{
+    typename Pair::first_type const & operator() (Pair const & p) const
+    { return p.first; }
+};
+
+/// @brief Key of a set element
+template <typename T>
+struct hash_identity
+{
+    T const & operator() (T const & x) const
+    { return x; }
+};
+
+/****** Control groups ********************************************************/
+
+/// @brief 16 control bytes, matched against a byte all at once
+/// @note Each match returns a bitmask, bit i standing for byte i. With SSE2
+///       a match is a compare and a movemask, otherwise a loop.
+class hash_group
+{
+    public:
+
+    enum { width = 16 };
+
+#if defined(__SSE2__)
+
+    private:
+
+    __m128i _ctrl;
+
+    unsigned _mask (__m128i m) const
+    { return static_cast<unsigned>(_mm_movemask_epi8(m)); }
+
+    public:
+
+    explicit hash_group (signed char const * ctrl)
+    : _ctrl(_mm_loadu_si128(reinterpret_cast<__m128i const *>(ctrl)))
+    { }
+
+    unsigned match (signed char h2) const
+    { return _mask(_mm_cmpeq_epi8(_mm_set1_epi8(h2), _ctrl)); }
+
+    unsigned match_empty () const
+    { return match(static_cast<signed char>(hash_ctrl_empty)); }
+
+    /// @note Only empty and deleted bytes have their sign bit set
+    unsigned match_empty_or_deleted () const
+    { return _mask(_ctrl); }
+
+#else
+
+    private:
+
+    signed char const * _ctrl;
+
+    public:
+
+    explicit hash_group (signed char const * ctrl)
+    : _ctrl(ctrl)
+    { }
+
+    unsigned match (signed char h2) const
+    {
+        unsigned m = 0;
+        for (unsigned i = 0; i < width; i++)
+            if (_ctrl[i] == h2)
+                m |= 1u << i;
+        return m;
+    }
+
+    unsigned match_empty () const
+    { return match(static_cast<signed char>(hash_ctrl_empty)); }
+
+    unsigned match_empty_or_deleted () const
+    {
+        unsigned m = 0;
+        for (unsigned i = 0; i < width; i++)
+            if (_ctrl[i] == hash_ctrl_empty || _ctrl[i] == hash_ctrl_deleted)
+                m |= 1u << i;
+        return m;
+    }
+
+#endif
+
+    /// @return Index of the lowest bit set in mask `m`, not 0
+    static unsigned lowest (unsigned m)
+    {
+#if defined(__GNUC__)
+        return static_cast<unsigned>(__builtin_ctz(m));
+#else
+        unsigned i = 0;
+        while (!(m & 1u))
+        {
+            m >>= 1;
+            i++;
+        }
+        return i;
+#endif
+    }
+};
+
+/// @brief Control bytes of a table without slots: the sentinel alone
+template <typename Dummy>
+struct hash_empty_ctrl
+{
+    static signed char const bytes[hash_group::width];
+};
+
+template <typename Dummy>
+signed char const hash_empty_ctrl<Dummy>::bytes[hash_group::width] = {
+    hash_ctrl_sentinel
+};
+
+/****** Hash table ************************************************************/
+
+/**
+ *  @brief Open addressing hash table of unique keys
+ *  @param KeyOfValue Functor returning the key of a value
+ *  @note Slots are probed by groups of 16 whose control bytes hold 7 bits of
+ *        their value hash: one SSE2 compare filters a whole group, so keys
+ *        are compared on likely hits only. The other hash bits pick the
+ *        first group, then groups are visited in triangular steps, which
+ *        covers them all since their count is a power of two.
+ *  @note Values never move but on rehash, so erasing keeps other iterators
+ *        valid. Erased slots become tombstones unless their group has an
+ *        empty slot left, in which case no probe ever went past it.
+ */
+template <typename Key, typename Value, typename KeyOfValue,
+          typename Hash = ft::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<Value> >
+class hash_table
+{
+    /****** Types *************************************************************/
+
+    public:
+
+    typedef Key                                 key_type;
+    typedef Value                               value_type;
+    typedef Hash                                hasher;
+    typedef KeyEqual                            key_equal;
+    typedef Allocator                           allocator_type;
+    typedef size_t                              size_type;
+
+    typedef hash_table_iterator<Value>          iterator;
+    typedef hash_table_iterator<Value const>    const_iterator;
+
+    private:
+
+    enum { width = hash_group::width };
+
+    static size_type npos ()
+    { return static_cast<size_type>(-1); }
+
+    /// @note Control bytes come from `Allocator` too.
+    typedef typename Allocator::template rebind<signed char>::other
+                                                ctrl_allocator_type;
+
+    /****** Data **************************************************************/
+
+    hasher                          _hash;
+    key_equal                       _eq;
+    KeyOfValue                      _key;
+    allocator_type                  _alloc;
+    signed char *                   _ctrl; // capacity bytes, then sentinel
+    Value *                         _slots;
+    size_type                       _capacity; // 0 or a power of two >= 16
+    size_type                       _size;
+    size_type                       _growth_left; // empty slots we may fill
+    float                           _max_load;
+
+    /****** Hashing ***********************************************************/
+
+    /// @brief Spread the bits of the user hash, which may be the identity
+    /// @note Murmur3 finalizer
+    static size_t _mix (size_t h)
+    {
+        h ^= h >> 16;
+        h *= 0x85ebca6bu;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35u;
+        h ^= h >> 16;
+        return h;
+    }
+
+    /// @return Control byte of hash `h`: its 7 low bits
+    static signed char _h2 (size_t h)
+    { return static_cast<signed char>(h & 0x7f); }
+
+    /// @return First group to probe for hash `h`, out of the other bits
+    size_type _h1 (size_t h) const
+    { return (h >> 7) & (_capacity / width - 1); }
+
+    /****** Capacity **********************************************************/
+
+    /// @return Number of slots we fill before growing, keeping one empty
+    ///         slot at least so that every probe ends
+    size_type _max_growth (size_type capacity) const
+    {
+        size_type n = static_cast<size_type>(
+            static_cast<double>(capacity) * static_cast<double>(_max_load));
+        return n < capacity ? n : capacity - 1;
+    }
+
+    /// @return Least valid capacity holding `n` values without growing
+    size_type _capacity_for (size_type n) const
+    {
+        size_type capacity = width;
+
+        while (_max_growth(capacity) < n)
+            capacity *= 2;
+        return capacity;
+    }
+
+    /****** Probing ***********************************************************/
+
+    /// @return Slot index of `key`, of hash `h`, or npos
+    size_type _find_index (key_type const & key, size_t h) const
+    {
+        if (_capacity == 0)
+            return npos();
+
+        size_type groups = _capacity / width;
+        size_type g = _h1(h);
+        signed char h2 = _h2(h);
+
+        for (size_type i = 1; ; i++)
+        {
+            hash_group group(_ctrl + g * width);
+            for (unsigned m = group.match(h2); m; m &= m - 1)
+            {
+                size_type index = g * width + hash_group::lowest(m);
+                if (_eq(_key(_slots[index]), key))
+                    return index;
+            }
+            if (group.match_empty())
+                return npos();
+            g = (g + i) & (groups - 1);
+        }
+    }
+
+    /// @return Index of the first empty or deleted slot on the probe
+    ///         sequence of hash `h`
+    size_type _find_insert_index (size_t h) const
+    {
+        size_type groups = _capacity / width;
+        size_type g = _h1(h);
+
+        for (size_type i = 1; ; i++)
+        {
+            unsigned m = hash_group(_ctrl + g * width).match_empty_or_deleted();
+            if (m)
+                return g * width + hash_group::lowest(m);
+            g = (g + i) & (groups - 1);
+        }
+    }
+
+    /// @brief Move every value to new arrays of `capacity` slots, which drops
+    ///        tombstones
+    void _rehash (size_type capacity)
+    {
+        signed char * old_ctrl = _ctrl;
+        Value * old_slots = _slots;
+        size_type old_capacity = _capacity;
+
+        _ctrl = ctrl_allocator_type(_alloc).allocate(capacity + 1);
+        _slots = _alloc.allocate(capacity);
+        _capacity = capacity;
+        for (size_type i = 0; i < capacity; i++)
+            _ctrl[i] = static_cast<signed char>(hash_ctrl_empty);
+        _ctrl[capacity] = static_cast<signed char>(hash_ctrl_sentinel);
+        _growth_left = _max_growth(capacity) - _size;
+
+        for (size_type i = 0; i < old_capacity; i++)
+        {
+            if (old_ctrl[i] < 0)
+                continue;
+            size_t h = _mix(_hash(_key(old_slots[i])));
+            size_type index = _find_insert_index(h);
+            _alloc.construct(_slots + index, old_slots[i]);
+            _alloc.destroy(old_slots + i);
+            _ctrl[index] = _h2(h);
+        }
+        if (old_capacity)
+        {
+            ctrl_allocator_type(_alloc).deallocate(old_ctrl, old_capacity + 1);
+            _alloc.deallocate(old_slots, old_capacity);
+        }
+    }
+
+    /// @brief Make room for one more value: grow when tombstones are not
+    ///        the reason the table is full, clean them up otherwise
+    void _prepare_insert ()
+    {
+        if (_capacity && _size + 1 <= _max_growth(_capacity) / 2)
+            return _rehash(_capacity);
+
+        size_type capacity = _capacity_for(_size + 1);
+        _rehash(capacity > _capacity * 2 ? capacity : _capacity * 2);
+    }
+
+    void _destroy ()
+    {
+        if (_capacity == 0)
+            return;
+        for (size_type i = 0; i < _capacity; i++)
+            if (_ctrl[i] >= 0)
+                _alloc.destroy(_slots + i);
+        ctrl_allocator_type(_alloc).deallocate(_ctrl, _capacity + 1);
+        _alloc.deallocate(_slots, _capacity);
+        _ctrl = const_cast<signed char *>(hash_empty_ctrl<void>::bytes);
+        _slots = NULL;
+        _capacity = 0;
+        _size = 0;
+        _growth_left = 0;
+    }
+
+    iterator _iterator (size_type index) const
+    { return iterator(_ctrl + index, _slots + index); }
+
+    /****** Public methods ****************************************************/
+
+    public:
+
+    /// @brief Constructor by default (1)
+    explicit hash_table (size_type bucket_count = 0,
+                         hasher const & hash = hasher(),
+                         key_equal const & eq = key_equal(),
+                         allocator_type const & alloc = allocator_type())
+    : _hash(hash), _eq(eq), _alloc(alloc),
+      _ctrl(const_cast<signed char *>(hash_empty_ctrl<void>::bytes)),
+      _slots(NULL), _capacity(0), _size(0), _growth_left(0), _max_load(0.875f)
+    { rehash(bucket_count); }
+
+    /// @brief Constructor by copy (2)
+    /// @note Same capacity, same slots: no rehash
+    hash_table (hash_table const & t)
+    : _hash(t._hash), _eq(t._eq), _alloc(t._alloc),
+      _ctrl(const_cast<signed char *>(hash_empty_ctrl<void>::bytes)),
+      _slots(NULL), _capacity(0), _size(0), _growth_left(0),
+      _max_load(t._max_load)
+    { *this = t; }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (3)
+    hash_table (hash_table && t)
+    : _hash(t._hash), _eq(t._eq), _alloc(t._alloc),
+      _ctrl(const_cast<signed char *>(hash_empty_ctrl<void>::bytes)),
+      _slots(NULL), _capacity(0), _size(0), _growth_left(0),
+      _max_load(t._max_load)
+    { swap(t); }
+#endif
+
+    ~hash_table ()
+    { _destroy(); }
+
+    hash_table & operator= (hash_table const & rhs)
+    {
+        if (this == &rhs)
+            return *this;
+        _destroy();
+        _hash = rhs._hash;
+        _eq = rhs._eq;
+        _max_load = rhs._max_load;
+        if (rhs._capacity == 0)
+            return *this;
+        _ctrl = ctrl_allocator_type(_alloc).allocate(rhs._capacity + 1);
+        _slots = _alloc.allocate(rhs._capacity);
+        _capacity = rhs._capacity;
+        for (size_type i = 0; i <= _capacity; i++)
+        {
+            _ctrl[i] = rhs._ctrl[i];
+            if (i < _capacity && _ctrl[i] >= 0)
+                _alloc.construct(_slots + i, rhs._slots[i]);
+        }
+        _size = rhs._size;
+        _growth_left = rhs._growth_left;
+        return *this;
+    }
+
+#if __cplusplus >= 201103L
+    hash_table & operator= (hash_table && rhs)
+    {
+        if (this == &rhs)
+            return *this;
+        _destroy();
+        swap(rhs);
+        return *this;
+    }
+#endif
+
+    /****** Iterators *********************************************************/
+
+    iterator begin ()
+    { return _iterator(0).skip_empty_slots(); }
+
+    const_iterator begin () const
+    { return _iterator(0).skip_empty_slots(); }
+
+    iterator end ()
+    { return _iterator(_capacity); }
+
+    const_iterator end () const
+    { return _iterator(_capacity); }
+
+    /****** Capacity **********************************************************/
+
+    bool empty () const
+    { return _size == 0; }
+
+    size_type size () const
+    { return _size; }
+
+    size_type max_size () const
+    { return _alloc.max_size(); }
+
+    /****** Modifiers *********************************************************/
+
+    /// @brief Insert `v` unless a value of equal key is already there
+    pair<iterator, bool> insert_unique (Value const & v)
+    {
+        size_t h = _mix(_hash(_key(v)));
+        size_type index = _find_index(_key(v), h);
+
+        if (index != npos())
+            return pair<iterator, bool>(_iterator(index), false);
+        if (_growth_left == 0)
+            _prepare_insert();
+        index = _find_insert_index(h);
+        if (_ctrl[index] == hash_ctrl_empty)
+            _growth_left--;
+        _alloc.construct(_slots + index, v);
+        _ctrl[index] = _h2(h);
+        _size++;
+        return pair<iterator, bool>(_iterator(index), true);
+    }
+
+    template <typename InputIterator>
+    void insert_range (InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+            insert_unique(*first);
+    }
+
+    void erase (const_iterator position)
+    {
+        size_type index = static_cast<size_type>(position.ctrl() - _ctrl);
+        size_type g = index / width;
+
+        _alloc.destroy(_slots + index);
+        if (hash_group(_ctrl + g * width).match_empty())
+        {
+            _ctrl[index] = static_cast<signed char>(hash_ctrl_empty);
+            _growth_left++;
+        }
+        else
+            _ctrl[index] = static_cast<signed char>(hash_ctrl_deleted);
+        _size--;
+    }
+
+    /// @return Number of values erased (0 or 1)
+    size_type erase (key_type const & key)
+    {
+        iterator it = find(key);
+        if (it == end())
+            return 0;
+        erase(it);
+        return 1;
+    }
+
+    /// @note Other slots don't move: walking on while erasing is fine
+    void erase (const_iterator first, const_iterator last)
+    {
+        while (first != last)
+            erase(first++);
+    }
+
+    /// @brief Destroy every value, keeping the slots
+    void clear ()
+    {
+        for (size_type i = 0; i < _capacity; i++)
+        {
+            if (_ctrl[i] >= 0)
+                _alloc.destroy(_slots + i);
+            _ctrl[i] = static_cast<signed char>(hash_ctrl_empty);
+        }
+        _size = 0;
+        _growth_left = _capacity ? _max_growth(_capacity) : 0;
+    }
+
+    /// @note The allocators are exchanged too, as the slots must go back to
+    ///       their own.
+    void swap (hash_table & t)
+    {
+        std::swap(_hash, t._hash);
+        std::swap(_eq, t._eq);
+        std::swap(_alloc, t._alloc);
+        std::swap(_ctrl, t._ctrl);
+        std::swap(_slots, t._slots);
+        std::swap(_capacity, t._capacity);
+        std::swap(_size, t._size);
+        std::swap(_growth_left, t._growth_left);
+        std::swap(_max_load, t._max_load);
+    }
+
+    /****** Lookup ************************************************************/
+
+    iterator find (key_type const & key) const
+    {
+        size_type index = _find_index(key, _mix(_hash(key)));
+        return _iterator(index == npos() ? _capacity : index);
+    }
+
+    /****** Hash policy *******************************************************/
+
+    /// @note Slots are the buckets of an open addressing table
+    size_type bucket_count () const
+    { return _capacity; }
+
+    float load_factor () const
+    {
+        return _capacity ? static_cast<float>(_size)
+                           / static_cast<float>(_capacity) : 0.0f;
+    }
+
+    float max_load_factor () const
+    { return _max_load; }
+
+    /// @note Clamped to (0, 1]: an open addressing table holds one value per
+    ///       slot at most, and always keeps one empty slot.
+    void max_load_factor (float ml)
+    {
+        _max_load = ml > 1.0f ? 1.0f : ml > 0.0f ? ml : _max_load;
+        if (_capacity == 0)
+            return;
+
+        // the growth budget depends on the factor: count it again
+        size_type capacity = _capacity_for(_size);
+        _rehash(capacity > _capacity ? capacity : _capacity);
+    }
+
+    /// @brief Set the number of slots to at least `n`, and enough for the
+    ///        current size under the max load factor
+    void rehash (size_type n)
+    {
+        size_type capacity = _size ? _capacity_for(_size) : 0;
+
+        while (capacity < n)
+            capacity = capacity ? capacity * 2 : size_type(width);
+        if (capacity != _capacity)
+        {
+            if (capacity)
+                _rehash(capacity);
+            else
+                _destroy();
+        }
+    }
+
+    /// @brief Make room for `n` values without rehashing
+    void reserve (size_type n)
+    {
+        if (n > _size)
+            rehash(_capacity_for(n));
+    }
+
+    /****** Observers *********************************************************/
+
+    hasher hash_function () const
+    { return _hash; }
+
+    key_equal key_eq () const
+    { return _eq; }
+
+    allocator_type get_allocator () const
+    { return _alloc; }
+};
+
+} // namespace
+
+#endif /* HASH_TABLE_HPP */
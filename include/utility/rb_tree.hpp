@@ -6,60 +6,482 @@
 #include <iostream> // std::ostream
 #include <fstream> // std::fstream
 #include <functional> // std::less
+#include <algorithm> // std::swap
+#include <limits> // std::numeric_limits
+#include <new> // placement new
+#include <stdexcept> // std::length_error
+#if __cplusplus >= 201103L
+# include <utility> // std::forward
+#endif
 
 #include "ft_iterator_base_types.hpp"
 #include "ft_reverse_iterator.hpp"
 #include "ft_type_traits.hpp"
+#include "ft_pair.hpp"
 
 /// @todo handle allocator failure
-/// @todo unsupport duplicate nodes
 
 namespace ft {
 
-template <typename T, typename Compare = std::less<T> >
+/****** Augmentation policies *************************************************/
+
+/**
+ *  An augmentation policy is a base of every node, holding a summary of the
+ *  node subtree. `update` recomputes it from both children summaries and the
+ *  node key. The sentinel keeps a default constructed one, so that must be
+ *  the summary of an empty subtree. When `enabled` is false, the tree never
+ *  calls `update`. `summary_type` is what range queries return.
+ *
+ *  `reads_mapped` tells whether `update` reads the mapped value of a map
+ *  element, which is not part of its order: `ft::map` then keeps mapped
+ *  values read-only, to be changed by its `update` and `modify` only.
+ */
+
+/// @brief No augmentation: nodes carry nothing more, nothing is maintained
+struct rb_no_augment
+{
+    static const bool enabled = false;
+    static const bool reads_mapped = false;
+
+    typedef void summary_type;
+
+    template <typename Key>
+    void update (rb_no_augment const &, rb_no_augment const &, Key const &)
+    { }
+};
+
+/// @brief Each node counts the nodes of its subtree, for order statistics
+struct rb_order_statistics
+{
+    static const bool enabled = true;
+    static const bool reads_mapped = false;
+
+    typedef size_t summary_type;
+
+    size_t size;
+
+    rb_order_statistics () : size(0) { }
+
+    template <typename Key>
+    void update (rb_order_statistics const & left,
+                 rb_order_statistics const & right, Key const &)
+    { size = left.size + right.size + 1; }
+};
+
+/**
+ *  @brief Each node folds the keys of its subtree, in order, with `Monoid`
+ *  @note `Monoid` provides a `value_type`, its `identity()`, an associative
+ *        `combine(a, b)` and `measure(key)`, the value of a single key. The
+ *        ones below measure a map element by its mapped value.
+ */
+template <typename Monoid>
+struct rb_monoid
+{
+    static const bool enabled = true;
+    static const bool reads_mapped = true;
+
+    typedef Monoid                          monoid_type;
+    typedef typename Monoid::value_type     summary_type;
+
+    summary_type summary;
+
+    rb_monoid () : summary(Monoid::identity()) { }
+
+    template <typename Key>
+    void update (rb_monoid const & left, rb_monoid const & right,
+                 Key const & key)
+    {
+        summary = Monoid::combine(
+            Monoid::combine(left.summary, Monoid::measure(key)), right.summary);
+    }
+};
+
+template <typename T>
+struct rb_sum
+{
+    typedef T value_type;
+
+    static T identity ()
+    { return T(); }
+
+    static T combine (T const & a, T const & b)
+    { return a + b; }
+
+    static T measure (T const & key)
+    { return key; }
+
+    template <typename K, typename V>
+    static T measure (pair<K, V> const & p)
+    { return T(p.second); }
+};
+
+template <typename T>
+struct rb_min
+{
+    typedef T value_type;
+
+    static T identity ()
+    { return std::numeric_limits<T>::max(); }
+
+    static T combine (T const & a, T const & b)
+    { return b < a ? b : a; }
+
+    static T measure (T const & key)
+    { return key; }
+
+    template <typename K, typename V>
+    static T measure (pair<K, V> const & p)
+    { return T(p.second); }
+};
+
+template <typename T>
+struct rb_max
+{
+    typedef T value_type;
+
+    static T identity ()
+    { return std::numeric_limits<T>::is_integer
+        ? std::numeric_limits<T>::min() : -std::numeric_limits<T>::max(); }
+
+    static T combine (T const & a, T const & b)
+    { return a < b ? b : a; }
+
+    static T measure (T const & key)
+    { return key; }
+
+    template <typename K, typename V>
+    static T measure (pair<K, V> const & p)
+    { return T(p.second); }
+};
+
+/****** Duplicate policies ****************************************************/
+
+/**
+ *  A duplicate policy tells whether the tree keeps equivalent keys. With
+ *  `rb_equal_keys`, `insert` always links a new node, after the equivalent
+ *  ones, and erasing or counting a key covers all of its nodes. Splits,
+ *  joins and set algebra cut the tree by key, so they require unique keys.
+ */
+
+/// @brief Unique keys: inserting an equivalent key is a no-op
+struct rb_unique_keys
+{
+    static const bool multi = false;
+};
+
+/// @brief Equivalent keys are kept side by side, in insertion order
+struct rb_equal_keys
+{
+    static const bool multi = true;
+};
+
+/****** Links policies ********************************************************/
+
+/**
+ *  A links policy tells how nodes refer to each other. Links are followed
+ *  through static functions of the node, given the tree sentinel.
+ *
+ *  With `rb_pointer_links`, nodes are allocated one by one and linked with
+ *  pointers, the colour in the low bit of the parent one.
+ *
+ *  With `rb_index_links`, nodes live in slabs of 1024 owned by the tree and
+ *  link to each other with 32-bit indexes: 16 bytes of links and colour
+ *  instead of 24. Index 0 is the sentinel, which also holds the slab table.
+ *  Erased nodes go on a free list, slabs are only released all at once by
+ *  `clear` and the destructor. As nodes belong to the slabs of their tree,
+ *  they can't move to another one: splits, joins, merges and node handles
+ *  require pointer links.
+ */
+
+struct rb_pointer_links
+{
+    static const bool indexed = false;
+
+    /// @brief Called by operations moving nodes to another tree, so that
+    ///        they don't compile with index links
+    static void movable_nodes () { }
+};
+
+struct rb_index_links
+{
+    static const bool indexed = true;
+};
+
+template <typename Node, typename Links>
+class rb_links;
+
+template <typename Node>
+struct rb_index_pool;
+
+/// @brief Links of `rb_pointer_links` nodes
+/// @note Nodes are at least pointer aligned, so the low bit of the parent
+///       pointer is always 0: the colour lives there.
+template <typename Node>
+class rb_links<Node, rb_pointer_links>
+{
+    public:
+
+    rb_links () : _left(NULL), _right(NULL), _parent_color(0) { }
+
+    bool red () const
+    { return _parent_color & 1; }
+
+    void paint (bool red)
+    { _parent_color = (_parent_color & ~size_t(1)) | static_cast<size_t>(red); }
+
+    /// @note Nothing to bind: a pointer tells where a node is by itself.
+    void bind (size_t) { }
+
+    static Node * left (Node const * x, Node *)
+    { return x->_left; }
+
+    static Node * right (Node const * x, Node *)
+    { return x->_right; }
+
+    static Node * parent (Node const * x, Node *)
+    { return reinterpret_cast<Node *>(x->_parent_color & ~size_t(1)); }
+
+    static void set_left (Node * x, Node * y, Node *)
+    { x->_left = y; }
+
+    static void set_right (Node * x, Node * y, Node *)
+    { x->_right = y; }
+
+    static void set_parent (Node * x, Node * y, Node *)
+    { x->_parent_color = reinterpret_cast<size_t>(y) | (x->_parent_color & 1); }
+
+    private:
+
+    Node *  _left;
+    Node *  _right;
+    size_t  _parent_color; // parent pointer | colour
+};
+
+/// @brief Links of `rb_index_links` nodes
+/// @note Index `i` is node `i % 1024` of slab `i / 1024`. A node knows its
+///       own slab, so its index is found back from its address.
+template <typename Node>
+class rb_links<Node, rb_index_links>
+{
+    public:
+
+    typedef unsigned int index_type; // 32 bits
+
+    static const index_type slab_shift = 10;
+    static const index_type slab_size = 1u << slab_shift;
+
+    rb_links () : _left(0), _right(0), _parent(0), _slab_color(0) { }
+
+    bool red () const
+    { return _slab_color & 1; }
+
+    void paint (bool red)
+    { _slab_color = (_slab_color & ~1u) | static_cast<index_type>(red); }
+
+    /// @brief Record that the node lies in slab `slab`
+    void bind (size_t slab)
+    { _slab_color = static_cast<index_type>(slab << 1) | (_slab_color & 1); }
+
+    static Node * left (Node const * x, Node * s)
+    { return at(x->_left, s); }
+
+    static Node * right (Node const * x, Node * s)
+    { return at(x->_right, s); }
+
+    static Node * parent (Node const * x, Node * s)
+    { return at(x->_parent, s); }
+
+    static void set_left (Node * x, Node * y, Node * s)
+    { x->_left = index_of(y, s); }
+
+    static void set_right (Node * x, Node * y, Node * s)
+    { x->_right = index_of(y, s); }
+
+    static void set_parent (Node * x, Node * y, Node * s)
+    { x->_parent = index_of(y, s); }
+
+    /// @return Node of index `i` in the tree of sentinel `s`
+    static Node * at (index_type i, Node * s)
+    {
+        return static_cast<rb_index_pool<Node> *>(s)->slabs[i >> slab_shift]
+               + (i & (slab_size - 1));
+    }
+
+    /// @return Index of node `x` in the tree of sentinel `s`
+    static index_type index_of (Node const * x, Node * s)
+    {
+        index_type slab = x->_slab_color >> 1;
+        Node const * base = static_cast<rb_index_pool<Node> *>(s)->slabs[slab];
+
+        return slab << slab_shift | static_cast<index_type>(x - base);
+    }
+
+    private:
+
+    index_type  _left;
+    index_type  _right;
+    index_type  _parent;
+    index_type  _slab_color; // slab << 1 | colour
+};
+
+/// @brief Sentinel of an `rb_index_links` tree, owning the node slabs
+/// @note Slab 0 is the sentinel alone, so that it is index 0. Node slabs
+///       start at 1, so does the table in `slabs[0]`, each of 1024 nodes.
+template <typename Node>
+struct rb_index_pool : public Node
+{
+    Node ** slabs;
+    size_t  slab_count;
+    size_t  slab_capacity;
+    size_t  next;       // first index never handed out
+    size_t  free_list;  // first free index, chained through the free nodes
+};
+
+/****** Storage policies ******************************************************/
+
+/**
+ *  A storage policy tells where nodes linked with pointers come from. Index
+ *  links bring their own slabs and ignore it.
+ *
+ *  With `rb_heap_storage`, each node is allocated on its own.
+ *
+ *  With `rb_slab_storage`, the tree carves its nodes out of slabs of
+ *  growing size, from 32 up to 4096 nodes, and keeps erased ones on a free
+ *  list for the next inserts: churn costs no allocator call once the tree
+ *  has grown.
+ *
+ *  With `rb_arena_storage`, for trees built once, read, then dropped, nodes
+ *  are bumped out of blocks from 1024 up to 65536 nodes and erased ones are
+ *  never reused: their memory stays until the tree is cleared.
+ *
+ *  Slabs and blocks are only released all at once by `clear` and the
+ *  destructor, without even a walk through the tree when there is nothing
+ *  to destroy. As nodes belong to the slabs of their tree, splits, joins,
+ *  merges and node handles require heap storage.
+ */
+
+struct rb_heap_storage
+{
+    static const bool bulk_release = false;
+
+    /// @brief Called by operations moving nodes to another tree, so that
+    ///        they don't compile with slab storage
+    static void movable_nodes () { }
+};
+
+struct rb_slab_storage
+{
+    static const bool bulk_release = true;
+    static const size_t first_slab = 32;
+    static const size_t last_slab = 4096;
+};
+
+/// @note Shares the slab code, but for the free list.
+struct rb_arena_storage : public rb_slab_storage
+{
+    static const size_t first_slab = 1024;
+    static const size_t last_slab = 65536;
+};
+
+/// @brief Sentinel of an `rb_slab_storage` or `rb_arena_storage` tree,
+///        owning the node slabs
+/// @note Each slab starts with a header in place of its first node.
+template <typename Node>
+struct rb_slab_pool : public Node
+{
+    struct header
+    {
+        Node *  next;   // previous slab
+        size_t  size;   // in nodes, header included
+    };
+
+    Node *  free_list;  // erased nodes, chained through their first word,
+                        // always empty in an arena
+    Node *  bump;       // first node never handed out in the last slab
+    Node *  bump_end;   // end of the last slab
+    Node *  slabs;      // last slab, chained through their headers
+    size_t  slab_size;  // nodes in the next slab
+};
+
+template <typename T, typename Compare = std::less<T>,
+          typename Augment = rb_no_augment,
+          typename Duplicates = rb_unique_keys,
+          typename Links = rb_pointer_links,
+          typename Storage = rb_heap_storage,
+          typename Allocator = std::allocator<T> >
 class rb_tree
 {
     /****** Types *************************************************************/
 
     private: struct node; // forward declaration
 
+    /// @brief Tag of the node constructor building its key in place
+    private: struct emplace_tag { };
+
     public:
 
     typedef T                           key_type;
     typedef Compare                     compare_type;
+    typedef Augment                     augment_type;
+    typedef Duplicates                  duplicate_policy;
+    typedef Links                       links_policy;
+    typedef Storage                     storage_policy;
     typedef size_t                      size_type;
     typedef struct node                 value_type;
     typedef struct node *               pointer;
     typedef enum { Black, Red }         color_type;
-    typedef std::allocator<struct node> allocator_type;
+    typedef typename Allocator::template rebind<struct node>::other
+                                        allocator_type;
+
+    /// @brief Number of lookups `find_batch` runs side by side, about as
+    ///        many cache misses as a core keeps in flight
+    static const size_t batch_width = 8;
 
     /****** Node **************************************************************/
 
     private:
 
-    struct node
+    typedef rb_links<struct node, Links> links_type;
+
+    /// @note Links come first, then the augment summary, then the key: with
+    ///       pointer links a `map<int, int>` node takes 32 bytes, 24 with
+    ///       index links.
+    struct node : public links_type, public Augment
     {
         key_type key;
-        color_type color;
-        pointer left;
-        pointer right;
-        pointer parent;
 
         /// @brief Constructor by default (1)
         node (key_type const & key = key_type())
-        : key(key), color(Black), left(NULL), right(NULL), parent(NULL) {}
+        : key(key) { }
 
         /// @brief Constructor by copy (2)
+        /// @note Only the key, summary and colour are copied: links are left
+        ///       for the new tree to set.
         node (struct node const & n)
-        : key(n.key), color(n.color), left(NULL), right(NULL), parent(NULL) { }
+        : links_type(), Augment(n), key(n.key)
+        { this->set_color(n.color()); }
+
+#if __cplusplus >= 201103L
+        /// @brief Constructor in place (3), `key` built out of `args`
+        template <typename... Args>
+        node (emplace_tag, Args &&... args)
+        : key(std::forward<Args>(args)...) { }
+#endif
 
         struct node & operator= (struct node const & rhs)
         {
+            Augment::operator=(rhs);
             this->key = rhs.key;
-            this->color = rhs.color;
+            this->set_color(rhs.color());
             return *this;
         }
 
+        color_type color () const
+        { return static_cast<color_type>(this->red()); }
+
+        void set_color (color_type c)
+        { this->paint(c == Red); }
+
 //        bool operator== (struct node const & rhs) const
 //        { return this->key == rhs.key; }
 
@@ -69,14 +491,73 @@ class rb_tree
 
     private:
 
-    pointer         _root;
-    size_type       _size;
-    value_type      _sentinel;
     allocator_type  _alloc;
     compare_type    _comp;
+    pointer         _sentinel;
+    pointer         _root;
+    size_type       _size;
 
     /****** Internals *********************************************************/
 
+    /// @brief Links of our nodes, through our sentinel
+    pointer _left (pointer x) const
+    { return node::left(x, _sentinel); }
+
+    pointer _right (pointer x) const
+    { return node::right(x, _sentinel); }
+
+    pointer _parent (pointer x) const
+    { return node::parent(x, _sentinel); }
+
+    void _set_left (pointer x, pointer y)
+    { node::set_left(x, y, _sentinel); }
+
+    void _set_right (pointer x, pointer y)
+    { node::set_right(x, y, _sentinel); }
+
+    void _set_parent (pointer x, pointer y)
+    { node::set_parent(x, y, _sentinel); }
+
+    /// @brief Links of the nodes of another tree, whose sentinel is `s`
+    static pointer _left (pointer x, pointer s)
+    { return node::left(x, s); }
+
+    static pointer _right (pointer x, pointer s)
+    { return node::right(x, s); }
+
+    static pointer _parent (pointer x, pointer s)
+    { return node::parent(x, s); }
+
+    /// @brief Min and max nodes, cached as the sentinel children
+    /// @note Kept up to date by `_link` and `extract` in O(1), by
+    ///       `_reset_bounds` after bulk operations, so `begin()` and
+    ///       `--end()` never descend. Both are the sentinel when empty.
+    pointer _leftmost () const
+    { return _left(_sentinel); }
+
+    pointer _rightmost () const
+    { return _right(_sentinel); }
+
+    /// @brief Recompute the cached min and max nodes from the root
+    void _reset_bounds ()
+    {
+        _set_left(_sentinel, min(_root));
+        _set_right(_sentinel, max(_root));
+    }
+
+    /// @brief Recompute the summary of `x` from its children ones
+    void _update (pointer x)
+    { x->update(*_left(x), *_right(x), x->key); }
+
+    /// @brief Recompute summaries from `x` up to the root
+    void _update_path (pointer x)
+    {
+        if (!Augment::enabled)
+            return;
+        for (; x != _sentinel; x = _parent(x))
+            _update(x);
+    }
+
     /**
      *  @pre 'x' right child is not the sentinel node
      *
@@ -89,19 +570,24 @@ class rb_tree
      */
     void _left_rotate (pointer x)
     {
-        pointer y = x->right;
-        x->right = y->left;
-        if (y->left)
-            y->left->parent = x;
-        y->parent = x->parent;
-        if (x->parent == &_sentinel)
+        pointer y = _right(x);
+        _set_right(x, _left(y));
+        if (_left(y) != _sentinel)
+            _set_parent(_left(y), x);
+        _set_parent(y, _parent(x));
+        if (_parent(x) == _sentinel)
             _root = y;
-        else if (x == x->parent->left)
-            x->parent->left = y;
+        else if (x == _left(_parent(x)))
+            _set_left(_parent(x), y);
         else
-            x->parent->right = y;
-        y->left = x;
-        x->parent = y;
+            _set_right(_parent(x), y);
+        _set_left(y, x);
+        _set_parent(x, y);
+        if (Augment::enabled)
+        {
+            _update(x);
+            _update(y);
+        }
     }
 
     /**
@@ -116,444 +602,1983 @@ class rb_tree
      */
     void _right_rotate (pointer y)
     {
-        pointer x = y->left;
-        y->left = x->right;
-        if (x->right)
-            x->right->parent = y;
-        x->parent = y->parent;
-        if (y->parent == &_sentinel)
+        pointer x = _left(y);
+        _set_left(y, _right(x));
+        if (_right(x) != _sentinel)
+            _set_parent(_right(x), y);
+        _set_parent(x, _parent(y));
+        if (_parent(y) == _sentinel)
             _root = x;
-        else if (y == y->parent->left)
-            y->parent->left = x;
+        else if (y == _left(_parent(y)))
+            _set_left(_parent(y), x);
         else
-            y->parent->right = x;
-        x->right = y;
-        y->parent = x;
+            _set_right(_parent(y), x);
+        _set_right(x, y);
+        _set_parent(y, x);
+        if (Augment::enabled)
+        {
+            _update(y);
+            _update(x);
+        }
     }
 
     /// @param z A newly inserted red node
     /// @note If 'z' is root its parent node (sentinel) is black
-    void _insert_fixup (pointer z)
+    /// @return true if the root had to be blackened, i.e. the black height of
+    ///         the tree grew by one
+    bool _insert_fixup (pointer z)
     {
         pointer y; // 'z' uncle
-        while (z->parent->color == Red)
+        while (_parent(z)->color() == Red)
         {
             // left-balance
-            if (z->parent == z->parent->parent->left)
+            if (_parent(z) == _left(_parent(_parent(z))))
             {
-                y = z->parent->parent->right;
+                y = _right(_parent(_parent(z)));
                 // case 1
-                if (y->color == Red)
+                if (y->color() == Red)
                 {
-                    z->parent->color = Black;
-                    y->color = Black;
-                    z->parent->parent->color = Red;
-                    z = z->parent->parent;
+                    _parent(z)->set_color(Black);
+                    y->set_color(Black);
+                    _parent(_parent(z))->set_color(Red);
+                    z = _parent(_parent(z));
                 }
                 else
                 {
                     // case 2
-                    if (z == z->parent->right)
+                    if (z == _right(_parent(z)))
                     {
-                        z = z->parent;
+                        z = _parent(z);
                         _left_rotate(z);
                     }
                     // case 3
-                    z->parent->color = Black;
-                    z->parent->parent->color = Red;
-                    _right_rotate(z->parent->parent);
+                    _parent(z)->set_color(Black);
+                    _parent(_parent(z))->set_color(Red);
+                    _right_rotate(_parent(_parent(z)));
                 }
             }
             // right-balance
             else
             {
-                y = z->parent->parent->left;
+                y = _left(_parent(_parent(z)));
                 // case 1
-                if (y->color == Red)
+                if (y->color() == Red)
                 {
-                    z->parent->color = Black;
-                    y->color = Black;
-                    z->parent->parent->color = Red;
-                    z = z->parent->parent;
+                    _parent(z)->set_color(Black);
+                    y->set_color(Black);
+                    _parent(_parent(z))->set_color(Red);
+                    z = _parent(_parent(z));
                 }
                 else
                 {
                     // case 2
-                    if (z == z->parent->left)
+                    if (z == _left(_parent(z)))
                     {
-                        z = z->parent;
+                        z = _parent(z);
                         _right_rotate(z);
                     }
                     // case 3
-                    z->parent->color = Black;
-                    z->parent->parent->color = Red;
-                    _left_rotate(z->parent->parent);
+                    _parent(z)->set_color(Black);
+                    _parent(_parent(z))->set_color(Red);
+                    _left_rotate(_parent(_parent(z)));
                 }
             }
         }
-        _root->color = Black;
+        if (_root->color() == Black)
+            return false;
+        _root->set_color(Black);
+        return true;
     }
 
     void _erase_fixup (pointer x)
     {
         pointer w; // `x` sibling
-        while (x != _root && x->color == Black)
+        while (x != _root && x->color() == Black)
         {
             // left-balance
-            if (x == x->parent->left)
+            if (x == _left(_parent(x)))
             {
-                w = x->parent->right;
+                w = _right(_parent(x));
                 // case 1
-                if (w->color == Red)
+                if (w->color() == Red)
                 {
-                    w->color = Black;
-                    x->parent->color = Red;
-                    _left_rotate(x->parent);
-                    w = x->parent->right;
+                    w->set_color(Black);
+                    _parent(x)->set_color(Red);
+                    _left_rotate(_parent(x));
+                    w = _right(_parent(x));
                 }
                 // case 2
-                if (w->left->color == Black && w->right->color == Black)
+                if (_left(w)->color() == Black && _right(w)->color() == Black)
                 {
-                    w->color = Red;
-                    x = x->parent;
+                    w->set_color(Red);
+                    x = _parent(x);
                 }
                 else
                 {
                     // case 3
-                    if (w->right->color == Black)
+                    if (_right(w)->color() == Black)
                     {
-                        w->left->color = Black;
-                        w->color = Red;
+                        _left(w)->set_color(Black);
+                        w->set_color(Red);
                         _right_rotate(w);
-                        w = x->parent->right;
+                        w = _right(_parent(x));
                     }
                     // case 4
-                    w->color = x->parent->color;
-                    x->parent->color = Black;
-                    w->right->color = Black;
-                    _left_rotate(x->parent);
+                    w->set_color(_parent(x)->color());
+                    _parent(x)->set_color(Black);
+                    _right(w)->set_color(Black);
+                    _left_rotate(_parent(x));
                     x = _root; // break
                 }
             }
             // right-balance
             else
             {
-                w = x->parent->left;
+                w = _left(_parent(x));
                 // case 1
-                if (w->color == Red)
+                if (w->color() == Red)
                 {
-                    w->color = Black;
-                    x->parent->color = Red;
-                    _right_rotate(x->parent);
-                    w = x->parent->left;
+                    w->set_color(Black);
+                    _parent(x)->set_color(Red);
+                    _right_rotate(_parent(x));
+                    w = _left(_parent(x));
                 }
                 // case 2
-                if (w->left->color == Black && w->right->color == Black)
+                if (_left(w)->color() == Black && _right(w)->color() == Black)
                 {
-                    w->color = Red;
-                    x = x->parent;
+                    w->set_color(Red);
+                    x = _parent(x);
                 }
                 else
                 {
                     // case 3
-                    if (w->left->color == Black)
+                    if (_left(w)->color() == Black)
                     {
-                        w->right->color = Black;
-                        w->color = Red;
+                        _right(w)->set_color(Black);
+                        w->set_color(Red);
                         _left_rotate(w);
-                        w = x->parent->left;
+                        w = _left(_parent(x));
                     }
                     // case 4
-                    w->color = x->parent->color;
-                    x->parent->color = Black;
-                    w->left->color = Black;
-                    _right_rotate(x->parent);
+                    w->set_color(_parent(x)->color());
+                    _parent(x)->set_color(Black);
+                    _left(w)->set_color(Black);
+                    _right_rotate(_parent(x));
                     x = _root; // break
                 }
             }
         }
-        x->color = Black;
+        x->set_color(Black);
     }
 
     /// @brief Replace subtree `u` by subtree `v`
     void _transplant (pointer u, pointer v)
     {
-        if (u->parent == &_sentinel)
+        if (_parent(u) == _sentinel)
             _root = v;
-        else if (u == u->parent->left)
-            u->parent->left = v;
+        else if (u == _left(_parent(u)))
+            _set_left(_parent(u), v);
         else
-            u->parent->right = v;
-        v->parent = u->parent;
+            _set_right(_parent(u), v);
+        _set_parent(v, _parent(u));
     }
 
-    /// @brief Destroy and deallocate subtree `x`
-    void _destroy (pointer x)
+    /// @brief Destroy and deallocate a single node
+    void _destroy_node (pointer x)
     {
-        if (x == &_sentinel)
-            return;
-        _destroy(x->left);
-        _destroy(x->right);
         _alloc.destroy(x);
-        _alloc.deallocate(x, 1);
+        _deallocate_node(x);
+    }
+
+    /// @brief Destroy and deallocate subtree `x` in post-order, iteratively
+    /// @note Links of `x` parent are left as is: it is up to the caller.
+    /// @return Number of nodes destroyed
+    size_type _destroy (pointer x)
+    {
+        size_type n = 0;
+        pointer stop;
+        pointer p;
+
+        if (x == _sentinel)
+            return 0;
+        stop = _parent(x);
+        while (x != stop)
+        {
+            if (_left(x) != _sentinel)
+                x = _left(x);
+            else if (_right(x) != _sentinel)
+                x = _right(x);
+            else
+            {
+                p = _parent(x);
+                if (p != stop)
+                {
+                    if (x == _left(p))
+                        _set_left(p, _sentinel);
+                    else
+                        _set_right(p, _sentinel);
+                }
+                _destroy_node(x);
+                n++;
+                x = p;
+            }
+        }
+        return n;
+    }
+
+    /// @brief Destroy every node, their memory then being released at once
+    /// @note With the memory going back by slabs and nothing to destroy in
+    ///       the nodes, there is no need to walk the tree at all.
+    void _destroy_all ()
+    {
+        if ((Links::indexed || Storage::bulk_release)
+            && is_trivially_destructible<struct node>::value)
+            return;
+        _destroy(_root);
+    }
+
+    /// @return Black height of subtree `x`, the sentinel counting for 0
+    size_type _black_height (pointer x) const
+    {
+        size_type h = 0;
+        for (; x != _sentinel; x = _left(x))
+            if (x->color() == Black)
+                h++;
+        return h;
+    }
+
+    /// @brief Make subtree `x` of black height `h` a standalone tree
+    /// @note A red root is blackened, which adds one to its black height.
+    void _detach (pointer x, size_type & h)
+    {
+        if (x == _sentinel)
+            return;
+        _set_parent(x, _sentinel);
+        if (x->color() == Red)
+        {
+            x->set_color(Black);
+            h++;
+        }
+    }
+
+    /**
+     *  @brief Join trees `l` and `r` through node `k`
+     *  @pre Every key of `l` < `k` key < every key of `r`, both `l` and `r`
+     *       are standalone trees (black root, sentinel parent) of black
+     *       heights `hl` and `hr`
+     *  @param h Black height of the joined tree
+     *  @return Root of the joined tree
+     *  @note `k` is hung on the spine of the taller tree, at the first black
+     *        node of the same black height as the other tree, then the red
+     *        violation it may cause is fixed up as for an insert. That costs
+     *        O(|hl - hr| + 1).
+     */
+    pointer _join (pointer l, size_type hl, pointer k, pointer r, size_type hr,
+                   size_type & h)
+    {
+        pointer c;
+        pointer p = _sentinel;
+        size_type hc;
+
+        k->set_color(Black);
+        _set_parent(k, _sentinel);
+        if (hl == hr)
+        {
+            _set_left(k, l);
+            _set_right(k, r);
+            if (l != _sentinel)
+                _set_parent(l, k);
+            if (r != _sentinel)
+                _set_parent(r, k);
+            if (Augment::enabled)
+                _update(k);
+            h = hl + 1;
+            return k;
+        }
+
+        pointer root = _root;
+        if (hl > hr)
+        {
+            // right spine of `l`
+            for (c = l, hc = hl; hc > hr || c->color() == Red; c = _right(c))
+            {
+                hc -= c->color() == Black;
+                p = c;
+            }
+            _set_right(p, k);
+            _set_left(k, c);
+            _set_right(k, r);
+            _root = l;
+            h = hl;
+        }
+        else
+        {
+            // left spine of `r`
+            for (c = r, hc = hr; hc > hl || c->color() == Red; c = _left(c))
+            {
+                hc -= c->color() == Black;
+                p = c;
+            }
+            _set_left(p, k);
+            _set_left(k, l);
+            _set_right(k, c);
+            _root = r;
+            h = hr;
+        }
+        _set_parent(k, p);
+        k->set_color(Red);
+        if (_left(k) != _sentinel)
+            _set_parent(_left(k), k);
+        if (_right(k) != _sentinel)
+            _set_parent(_right(k), k);
+        _update_path(k);
+        if (_insert_fixup(k))
+            h++;
+        std::swap(root, _root);
+        return root;
+    }
+
+    /**
+     *  @brief Split subtree `x` of black height `h` around `key`
+     *  @param l Standalone tree of the keys less than `key`, `hl` its black
+     *         height
+     *  @param r Standalone tree of the keys greater than `key`, `hr` its
+     *         black height
+     *  @return Detached node equivalent to `key`, or the sentinel
+     *  @note Descends once and joins the pieces on the way back: the join
+     *        costs telescope to O(log n).
+     */
+    pointer _split (pointer x, size_type h, key_type const & key,
+                    pointer & l, size_type & hl, pointer & r, size_type & hr)
+    {
+        pointer m;
+        pointer xl;
+        pointer xr;
+        size_type hc;
+
+        if (x == _sentinel)
+        {
+            l = _sentinel;
+            r = _sentinel;
+            hl = 0;
+            hr = 0;
+            return _sentinel;
+        }
+        xl = _left(x);
+        xr = _right(x);
+        hc = h - (x->color() == Black);
+        if (_comp(key, x->key))
+        {
+            m = _split(xl, hc, key, l, hl, r, hr);
+            _detach(xr, hc);
+            r = _join(r, hr, x, xr, hc, hr);
+        }
+        else if (_comp(x->key, key))
+        {
+            m = _split(xr, hc, key, l, hl, r, hr);
+            _detach(xl, hc);
+            l = _join(xl, hc, x, l, hl, hl);
+        }
+        else
+        {
+            m = x;
+            l = xl;
+            hl = hc;
+            r = xr;
+            hr = hc;
+            _detach(l, hl);
+            _detach(r, hr);
+            _set_left(m, _sentinel);
+            _set_right(m, _sentinel);
+            _set_parent(m, _sentinel);
+        }
+        return m;
     }
 
-    /// @return a deep copy of subtree `src`
+    /// @return a deep copy of subtree `src`, hung on our sentinel
     /// @param src root of subtree to be copied
     /// @param sentinel sentinel node of subtree `src`
+    /// @note Nodes created are added to `_size`.
     pointer _copy (pointer src, pointer sentinel)
     {
         pointer tmp;
         pointer dst;
         pointer dst_root;
+        pointer stop;
 
-        if (src == NULL)
-            return &_sentinel;
+        if (src == sentinel)
+            return _sentinel;
 
-        dst_root = _alloc.allocate(1);
-        _alloc.construct(dst_root, *src);
-        dst_root->parent = &_sentinel;
+        stop = _parent(src, sentinel);
+        dst_root = _clone_node(src);
+        _set_parent(dst_root, _sentinel);
         dst = dst_root;
+        _size++;
 
         while (1)
         {
-            while (src->left != sentinel)
+            while (_left(src, sentinel) != sentinel)
             {
-                dst->left = _alloc.allocate(1);
-                _alloc.construct(dst->left, *(src->left));
-                dst->left->parent = dst;
-                src = src->left;
-                dst = dst->left;
+                src = _left(src, sentinel);
+                _set_left(dst, _clone_node(src));
+                _set_parent(_left(dst), dst);
+                _size++;
+                dst = _left(dst);
             }
-            dst->left = &_sentinel;
+            _set_left(dst, _sentinel);
             while (1)
             {
-                if (src->right != sentinel)
+                if (_right(src, sentinel) != sentinel)
                 {
-                    dst->right = _alloc.allocate(1);
-                    _alloc.construct(dst->right, *src->right);
-                    dst->right->parent = dst;
-                    src = src->right;
-                    dst = dst->right;
+                    src = _right(src, sentinel);
+                    _set_right(dst, _clone_node(src));
+                    _set_parent(_right(dst), dst);
+                    _size++;
+                    dst = _right(dst);
                     break;
                 }
                 else
-                    dst->right = &_sentinel;
+                    _set_right(dst, _sentinel);
                 while (1)
                 {
                     tmp = src;
-                    src = src->parent;
-                    if (src == sentinel)
+                    src = _parent(src, sentinel);
+                    if (src == stop)
                         return dst_root;
-                    dst = dst->parent;
-                    if (tmp == src->left)
+                    dst = _parent(dst);
+                    if (tmp == _left(src, sentinel))
                         break;
                 }
             }
         }
     }
 
-    /****** Public methods ****************************************************/
-
-    public:
+    /**
+     *  Node memory
+     *
+     *  With pointer links nodes come from the storage policy: one by one
+     *  from the allocator, or out of the slabs of an `rb_slab_pool`
+     *  sentinel. With index links the sentinel is an `rb_index_pool`
+     *  handing out nodes from its slabs. Pools take back erased nodes on a
+     *  free list. Either way a node is bound to where it lies once
+     *  constructed.
+     */
 
-    /// @brief Constructor by default (1)
-    explicit rb_tree () : _root(&_sentinel), _size(0)
+    typedef rb_index_pool<struct node>                  index_pool_type;
+    typedef rb_slab_pool<struct node>                   slab_pool_type;
+    typedef typename slab_pool_type::header             slab_header_type;
+
+    /// @note Sentinel pools and the slab table come from `Allocator` too,
+    ///       rebound and built out of `_alloc`.
+    typedef typename Allocator::template rebind<index_pool_type>::other
+                                                        index_pool_allocator_type;
+    typedef typename Allocator::template rebind<pointer>::other
+                                                        table_allocator_type;
+    typedef typename Allocator::template rebind<slab_pool_type>::other
+                                                        slab_pool_allocator_type;
+
+    /// @brief Allocate the sentinel node, linked to itself as an empty tree
+    /// @note It lives on the heap, not inside the tree, so that swapping two
+    ///       trees never has to re-point the leaves of either one.
+    pointer _create_sentinel ()
     {
-        _sentinel.left = _root;
-        _sentinel.right = _root;
-        _sentinel.parent = _root;
+        pointer s = _create_sentinel(Links());
+        node::set_left(s, s, s);
+        node::set_right(s, s, s);
+        node::set_parent(s, s, s);
+        return s;
     }
 
-    /// @brief Constructor by copy (2)
-    rb_tree (rb_tree const & tree) : _root(&_sentinel)
-    { *this = tree; }
+    pointer _create_sentinel (rb_pointer_links)
+    { return _create_sentinel(Storage()); }
 
-    /// @brief Recursive destructor
-//    ~rb_tree ()
-//    { _destroy(_root); }
+    pointer _create_sentinel (rb_heap_storage)
+    {
+        pointer s = _alloc.allocate(1);
+        _alloc.construct(s, value_type());
+        return s;
+    }
 
-    /// @brief Iterative destructor
-    ~rb_tree ()
+    /// @note No slab until the first insert.
+    pointer _create_sentinel (rb_slab_storage)
     {
-        pointer x = _root;
-        pointer p = x->parent;
-        while (x != &_sentinel)
-        {
-            p = x->parent;
-            while (x != &_sentinel && x->left != &_sentinel)
-            {
-                p = x;
-                x = x->left;
-            }
-            if (x != &_sentinel && x->right != &_sentinel)
-            {
-                p = x;
-                x = x->right;
-            }
-            if (x != &_sentinel && x->left == &_sentinel && x->right == &_sentinel)
-            {
-                _alloc.destroy(x);
-                _alloc.deallocate(x, 1);
-                if (p != &_sentinel)
-                    x == p->left ? p->left = &_sentinel : p->right = &_sentinel;
-                x = p;
-            }
-        }
+        slab_pool_type * pool = slab_pool_allocator_type(_alloc).allocate(1);
+
+        ::new (static_cast<void *>(pool)) value_type();
+        pool->free_list = NULL;
+        pool->bump = NULL;
+        pool->bump_end = NULL;
+        pool->slabs = NULL;
+        pool->slab_size = Storage::first_slab;
+        return pool;
     }
 
-    /// @brief Insert base routine
-    /// @param z New node to be inserted in the tree
-    void insert (pointer z)
+    /// @note Slab 0 holds the sentinel alone, so it is index 0.
+    pointer _create_sentinel (rb_index_links)
     {
-        pointer y = &_sentinel;
-        pointer x = _root;
+        index_pool_allocator_type alloc(_alloc);
+        table_allocator_type table_alloc(_alloc);
+        index_pool_type * pool = alloc.allocate(1);
+
+        ::new (static_cast<void *>(pool)) value_type();
+        pool->slab_capacity = 16;
+        pool->slabs = table_alloc.allocate(pool->slab_capacity);
+        pool->slabs[0] = pool;
+        pool->slab_count = 1;
+        pool->next = links_type::slab_size;
+        pool->free_list = 0;
+        return pool;
+    }
 
-        while (x != &_sentinel)
-        {
-            y = x;
-            if (_comp(z->key, x->key))
-                x = x->left;
-            else
-                x = x->right;
-        }
-        z->parent = y;
-        if (y == &_sentinel) // ?? _sentinel->parent == &_sentinel ?
-        {
-            _root = z;
-            _sentinel.left = _root;
-            _sentinel.right = _root;
+    void _destroy_sentinel (rb_pointer_links)
+    { _destroy_sentinel(Storage()); }
 
-        }
-        else if (_comp(z->key, y->key))
-            y->left = z;
-        else
-            y->right = z;
-        z->left = &_sentinel;
-        z->right = &_sentinel;
-        z->color = Red;
-        _insert_fixup(z);
+    void _destroy_sentinel (rb_heap_storage)
+    { _destroy_node(_sentinel); }
+
+    void _destroy_sentinel (rb_slab_storage)
+    {
+        _release_slabs(rb_slab_storage());
+        _alloc.destroy(_sentinel);
+        slab_pool_allocator_type(_alloc).deallocate(
+            static_cast<slab_pool_type *>(_sentinel), 1);
     }
 
-    /// @brief Insert by key
-    /// @param key Key of the new node inserted
-    /// @note Is it necessary ?...
-    void insert (key_type const & key)
+    void _destroy_sentinel (rb_index_links)
     {
-        // do not insert duplicated key
-        if (find(_root, key))
-            return;
+        index_pool_type * pool = static_cast<index_pool_type *>(_sentinel);
+
+        _release_slabs(rb_index_links());
+        table_allocator_type(_alloc).deallocate(pool->slabs, pool->slab_capacity);
+        _alloc.destroy(_sentinel);
+        index_pool_allocator_type(_alloc).deallocate(pool, 1);
+    }
+
+    /// @brief Room for one node, `slab` receiving where it lies
+    pointer _allocate_node (size_t & slab)
+    { return _allocate_node(slab, Links()); }
+
+    pointer _allocate_node (size_t & slab, rb_pointer_links)
+    {
+        slab = 0;
+        return _allocate_node(Storage());
+    }
+
+    pointer _allocate_node (rb_heap_storage)
+    { return _alloc.allocate(1); }
+
+    /// @note Free nodes first, then the next one never handed out, opening
+    ///       a slab twice as big as the last one when it is full.
+    pointer _allocate_node (rb_slab_storage)
+    {
+        slab_pool_type * pool = static_cast<slab_pool_type *>(_sentinel);
+        pointer x = pool->free_list;
+
+        if (x)
+        {
+            pool->free_list = *static_cast<pointer *>(static_cast<void *>(x));
+            return x;
+        }
+        if (pool->bump == pool->bump_end)
+        {
+            pointer slab = _alloc.allocate(pool->slab_size);
+            slab_header_type header = { pool->slabs, pool->slab_size };
+
+            ::new (static_cast<void *>(slab)) slab_header_type(header);
+            pool->slabs = slab;
+            pool->bump = slab + 1;
+            pool->bump_end = slab + pool->slab_size;
+            if (pool->slab_size < Storage::last_slab)
+                pool->slab_size *= 2;
+        }
+        return pool->bump++;
+    }
+
+    /// @note Free nodes first, then the next one never handed out, opening
+    ///       a new slab every 1024 nodes.
+    pointer _allocate_node (size_t & slab, rb_index_links)
+    {
+        index_pool_type * pool = static_cast<index_pool_type *>(_sentinel);
+        size_t i = pool->free_list;
+
+        if (i)
+        {
+            pointer x = links_type::at(static_cast<unsigned int>(i), _sentinel);
+            pool->free_list = *static_cast<size_t *>(static_cast<void *>(x));
+            slab = i >> links_type::slab_shift;
+            return x;
+        }
+        i = pool->next;
+        slab = i >> links_type::slab_shift;
+        if (slab == pool->slab_count)
+        {
+            if (i > size_t(static_cast<unsigned int>(-1)))
+                throw std::length_error("rb_tree: too many nodes for index links");
+            if (pool->slab_count == pool->slab_capacity)
+                _grow_slab_table(pool);
+            pool->slabs[slab] = _alloc.allocate(links_type::slab_size);
+            pool->slab_count++;
+        }
+        pool->next++;
+        return pool->slabs[slab] + (i & (links_type::slab_size - 1));
+    }
+
+    /// @brief Double the capacity of the slab table of `pool`
+    void _grow_slab_table (index_pool_type * pool)
+    {
+        table_allocator_type alloc(_alloc);
+        pointer * slabs = alloc.allocate(2 * pool->slab_capacity);
+
+        std::copy(pool->slabs, pool->slabs + pool->slab_count, slabs);
+        alloc.deallocate(pool->slabs, pool->slab_capacity);
+        pool->slabs = slabs;
+        pool->slab_capacity *= 2;
+    }
+
+    /// @brief Give back the room of destroyed node `x`
+    void _deallocate_node (pointer x)
+    { _deallocate_node(x, Links()); }
+
+    void _deallocate_node (pointer x, rb_pointer_links)
+    { _deallocate_node(x, Storage()); }
+
+    void _deallocate_node (pointer x, rb_heap_storage)
+    { _alloc.deallocate(x, 1); }
+
+    /// @note The free list is chained through the raw memory of free nodes.
+    void _deallocate_node (pointer x, rb_slab_storage)
+    {
+        slab_pool_type * pool = static_cast<slab_pool_type *>(_sentinel);
+
+        ::new (static_cast<void *>(x)) pointer(pool->free_list);
+        pool->free_list = x;
+    }
+
+    /// @note Monotonic: the room is only given back with its block.
+    void _deallocate_node (pointer, rb_arena_storage)
+    { }
+
+    /// @note The free list is chained through the raw memory of free nodes.
+    void _deallocate_node (pointer x, rb_index_links)
+    {
+        index_pool_type * pool = static_cast<index_pool_type *>(_sentinel);
+        size_t i = links_type::index_of(x, _sentinel);
+
+        ::new (static_cast<void *>(x)) size_t(pool->free_list);
+        pool->free_list = i;
+    }
+
+    /// @brief Give back the room of node `x` lying in slab `slab`, whose
+    ///        construction failed
+    /// @note A node never built doesn't know its slab yet.
+    void _deallocate_node (pointer x, size_t slab)
+    { _deallocate_node(x, slab, Links()); }
+
+    void _deallocate_node (pointer x, size_t, rb_pointer_links)
+    { _deallocate_node(x, Storage()); }
+
+    void _deallocate_node (pointer x, size_t slab, rb_index_links)
+    {
+        index_pool_type * pool = static_cast<index_pool_type *>(_sentinel);
+        size_t i = slab << links_type::slab_shift
+                 | static_cast<size_t>(x - pool->slabs[slab]);
+
+        ::new (static_cast<void *>(x)) size_t(pool->free_list);
+        pool->free_list = i;
+    }
+
+    /// @brief Release the memory of every node at once, after they have all
+    ///        been destroyed
+    void _release_slabs (rb_pointer_links)
+    { _release_slabs(Storage()); }
+
+    void _release_slabs (rb_heap_storage)
+    { }
+
+    void _release_slabs (rb_slab_storage)
+    {
+        slab_pool_type * pool = static_cast<slab_pool_type *>(_sentinel);
+
+        while (pool->slabs)
+        {
+            pointer slab = pool->slabs;
+            slab_header_type * header
+                = static_cast<slab_header_type *>(static_cast<void *>(slab));
+
+            pool->slabs = header->next;
+            _alloc.deallocate(slab, header->size);
+        }
+        pool->free_list = NULL;
+        pool->bump = NULL;
+        pool->bump_end = NULL;
+        pool->slab_size = Storage::first_slab;
+    }
 
-        // alloc and construct
-        pointer new_node = _alloc.allocate(1);
-        _alloc.construct(new_node, value_type(key));
+    void _release_slabs (rb_index_links)
+    {
+        index_pool_type * pool = static_cast<index_pool_type *>(_sentinel);
+
+        for (size_t i = 1; i < pool->slab_count; i++)
+            _alloc.deallocate(pool->slabs[i], links_type::slab_size);
+        pool->slab_count = 1;
+        pool->next = links_type::slab_size;
+        pool->free_list = 0;
+    }
+
+    /// @brief Allocate a detached copy of node `src`, of any tree
+    pointer _clone_node (pointer src)
+    {
+        size_t slab;
+        pointer z = _allocate_node(slab);
+
+        try { _alloc.construct(z, *src); }
+        catch (...) { _deallocate_node(z, slab); throw; }
+        z->bind(slab);
+        return z;
+    }
 
-        // insert
-        insert(new_node);
+    /// @brief Allocate and construct a detached node holding `key`
+    /// @note Constructed right in place: `key` is copied once, with no node
+    ///       temporary in between.
+    pointer _create_node (key_type const & key)
+    {
+        size_t slab;
+        pointer z = _allocate_node(slab);
 
-        // update size
+        try { ::new (static_cast<void *>(z)) value_type(key); }
+        catch (...) { _deallocate_node(z, slab); throw; }
+        z->bind(slab);
+        return z;
+    }
+
+#if __cplusplus >= 201103L
+    /// @brief Allocate a detached node whose key is built out of `args`
+    template <typename... Args>
+    pointer _emplace_node (Args &&... args)
+    {
+        size_t slab;
+        pointer z = _allocate_node(slab);
+
+        try
+        {
+            ::new (static_cast<void *>(z)) value_type(emplace_tag(),
+                                                      std::forward<Args>(args)...);
+        }
+        catch (...) { _deallocate_node(z, slab); throw; }
+        z->bind(slab);
+        return z;
+    }
+#endif
+
+    /// @brief Link `z` as left or right child of leaf parent `y` then rebalance
+    /// @pre `y` is the sentinel (empty tree) or its `left`/`right` child slot
+    ///      is free
+    void _link (pointer z, pointer y, bool left)
+    {
+        _set_parent(z, y);
+        if (y == _sentinel)
+            _root = z;
+        else if (left)
+            _set_left(y, z);
+        else
+            _set_right(y, z);
+        _set_left(z, _sentinel);
+        _set_right(z, _sentinel);
+        z->set_color(Red);
+        if (y == _sentinel || (left && y == _leftmost()))
+            _set_left(_sentinel, z);
+        if (y == _sentinel || (!left && y == _rightmost()))
+            _set_right(_sentinel, z);
+        _update_path(z);
+        _insert_fixup(z);
+    }
+
+    /// @brief Link detached node `z` right before `pos` (the sentinel for
+    ///        after the max node)
+    /// @pre `z` key belongs there
+    /// @note No comparison: either `pos` left slot is free, or its in-order
+    ///       predecessor's right one is.
+    pointer _link_before (pointer pos, pointer z)
+    {
+        if (pos == _sentinel)
+            _link(z, _rightmost(), false);
+        else if (_left(pos) == _sentinel)
+            _link(z, pos, true);
+        else
+            _link(z, max(_left(pos)), false);
         _size++;
+        return z;
+    }
+
+    /// @brief Create a node holding `key` and link it below leaf parent `y`
+    pair<pointer, bool> _insert_at (pointer y, bool left, key_type const & key)
+    {
+        pointer z = _create_node(key);
+        _link(z, y, left);
+        _size++;
+        return pair<pointer, bool>(z, true);
+    }
+
+    /// @brief Insert `key` before every equivalent key already in the tree
+    pointer _insert_equal_lower (key_type const & key)
+    {
+        pointer y = _sentinel;
+        pointer x = _root;
+        bool left = true;
+
+        while (x != _sentinel)
+        {
+            y = x;
+            left = !_comp(x->key, key);
+            x = left ? _left(x) : _right(x);
+        }
+        return _insert_at(y, left, key).first;
+    }
+
+    /// @return in-order successor of `x`, or the sentinel if `x` is max
+    pointer _next (pointer x) const
+    {
+        if (_right(x) != _sentinel)
+            return min(_right(x));
+        pointer p = _parent(x);
+        while (p != _sentinel && x == _right(p))
+        {
+            x = p;
+            p = _parent(p);
+        }
+        return p;
+    }
+
+    /// @return in-order predecessor of `x`, or the sentinel if `x` is min
+    pointer _prev (pointer x) const
+    {
+        if (_left(x) != _sentinel)
+            return max(_left(x));
+        pointer p = _parent(x);
+        while (p != _sentinel && x == _left(p))
+        {
+            x = p;
+            p = _parent(p);
+        }
+        return p;
+    }
+
+    /// @brief Build a balanced subtree out of the next `n` nodes of `list`
+    /// @param list In-order chain of detached nodes linked through `right`,
+    ///        advanced past the nodes consumed
+    /// @param depth Depth of the subtree root
+    /// @param red_depth Depth of the last, incomplete, level of the whole
+    ///        tree. Its nodes are red so every path holds the same number of
+    ///        black nodes.
+    pointer _build (pointer & list, size_type n, size_type depth,
+                    size_type red_depth)
+    {
+        if (n == 0)
+            return _sentinel;
+
+        pointer left = _build(list, (n - 1) / 2, depth + 1, red_depth);
+        pointer x = list;
+        list = _right(list);
+        _set_left(x, left);
+        _set_right(x, _build(list, n - 1 - (n - 1) / 2, depth + 1, red_depth));
+        if (_left(x) != _sentinel)
+            _set_parent(_left(x), x);
+        if (_right(x) != _sentinel)
+            _set_parent(_right(x), x);
+        x->set_color(depth == red_depth ? Red : Black);
+        if (Augment::enabled)
+            _update(x);
+        return x;
+    }
+
+    /// @brief Join trees `l` and `r` with no middle node
+    /// @pre Every key of `l` < every key of `r`, both are standalone trees
+    /// @note The max node of `l` is split off to serve as middle node.
+    pointer _join2 (pointer l, size_type hl, pointer r, size_type hr,
+                    size_type & h)
+    {
+        pointer k;
+        pointer none;
+        size_type hnone;
+
+        if (l == _sentinel)
+        {
+            h = hr;
+            return r;
+        }
+        if (r == _sentinel)
+        {
+            h = hl;
+            return l;
+        }
+        k = max(l);
+        _split(l, hl, k->key, l, hl, none, hnone);
+        return _join(l, hl, k, r, hr, h);
+    }
+
+    /// @brief Hang subtree `x` of another tree, whose sentinel is `from`,
+    ///        on our sentinel
+    /// @note Visits every node of `x` once, iteratively.
+    /// @return Number of nodes in `x`
+    size_type _adopt (pointer x, pointer from)
+    {
+        size_type n = 0;
+        pointer stop;
+        pointer prev;
+        pointer next;
+
+        if (x == from)
+            return 0;
+        stop = _parent(x);
+        prev = stop;
+        while (x != stop)
+        {
+            // first visit
+            if (prev == _parent(x))
+            {
+                n++;
+                if (_left(x) == from)
+                    _set_left(x, _sentinel);
+                if (_right(x) == from)
+                    _set_right(x, _sentinel);
+                if (_left(x) != _sentinel)
+                    next = _left(x);
+                else if (_right(x) != _sentinel)
+                    next = _right(x);
+                else
+                    next = _parent(x);
+            }
+            // back from left subtree
+            else if (prev == _left(x) && _right(x) != _sentinel)
+                next = _right(x);
+            // back from last subtree
+            else
+                next = _parent(x);
+            prev = x;
+            x = next;
+        }
+        return n;
+    }
+
+    /**
+     *  Set algebra
+     *
+     *  `t1` is a standalone tree of ours of black height `h1`, `t2` a subtree
+     *  of another tree of black height `h2`, whose sentinel is `s2`, only read.
+     *  `t1` is split around `t2` root key, both halves are processed
+     *  recursively with `t2` children then joined back. This costs
+     *  O(m log(n/m + 1)) comparisons with m <= n the sizes of both trees.
+     *  `h` receives the black height of the returned standalone tree.
+     */
+
+    /// @brief Keys of `t1` or `t2`, nodes of `t2` missing in `t1` are copied
+    pointer _union (pointer t1, size_type h1, pointer t2, size_type h2,
+                    pointer s2, size_type & h)
+    {
+        pointer l, m, r;
+        size_type hl, hr, hc;
+
+        if (t2 == s2)
+        {
+            h = h1;
+            return t1;
+        }
+        if (t1 == _sentinel)
+        {
+            h = h2;
+            t1 = _copy(t2, s2);
+            _detach(t1, h);
+            return t1;
+        }
+        m = _split(t1, h1, t2->key, l, hl, r, hr);
+        hc = h2 - (t2->color() == Black);
+        l = _union(l, hl, _left(t2, s2), hc, s2, hl);
+        r = _union(r, hr, _right(t2, s2), hc, s2, hr);
+        if (m == _sentinel)
+        {
+            m = _create_node(t2->key);
+            _size++;
+        }
+        return _join(l, hl, m, r, hr, h);
+    }
+
+    /// @brief Keys of `t1` also in `t2`, other nodes of `t1` are destroyed
+    pointer _intersection (pointer t1, size_type h1, pointer t2, size_type h2,
+                           pointer s2, size_type & h)
+    {
+        pointer l, m, r;
+        size_type hl, hr, hc;
+
+        if (t1 == _sentinel || t2 == s2)
+        {
+            _size -= _destroy(t1);
+            h = 0;
+            return _sentinel;
+        }
+        m = _split(t1, h1, t2->key, l, hl, r, hr);
+        hc = h2 - (t2->color() == Black);
+        l = _intersection(l, hl, _left(t2, s2), hc, s2, hl);
+        r = _intersection(r, hr, _right(t2, s2), hc, s2, hr);
+        if (m == _sentinel)
+            return _join2(l, hl, r, hr, h);
+        return _join(l, hl, m, r, hr, h);
+    }
+
+    /// @brief Keys of `t1` not in `t2`, other nodes of `t1` are destroyed
+    pointer _difference (pointer t1, size_type h1, pointer t2, size_type h2,
+                         pointer s2, size_type & h)
+    {
+        pointer l, m, r;
+        size_type hl, hr, hc;
+
+        if (t1 == _sentinel || t2 == s2)
+        {
+            h = h1;
+            return t1;
+        }
+        m = _split(t1, h1, t2->key, l, hl, r, hr);
+        if (m != _sentinel)
+        {
+            _destroy_node(m);
+            _size--;
+        }
+        hc = h2 - (t2->color() == Black);
+        l = _difference(l, hl, _left(t2, s2), hc, s2, hl);
+        r = _difference(r, hr, _right(t2, s2), hc, s2, hr);
+        return _join2(l, hl, r, hr, h);
+    }
+
+    /// @brief Make `root` the root of the tree
+    void _set_root (pointer root)
+    {
+        _root = root;
+        if (_root != _sentinel)
+            _set_parent(_root, _sentinel);
+        _reset_bounds();
+    }
+
+    /// @brief Hint the cache to start loading node `x`
+    static void _prefetch (pointer x)
+    {
+#if defined(__GNUC__)
+        __builtin_prefetch(x);
+#else
+        (void)x;
+#endif
+    }
+
+    /// @return first node of subtree `x` whose key is not less than `key`,
+    ///         or `y` if there is none
+    template <typename K>
+    pointer _lower_bound (pointer x, pointer y, K const & key) const
+    {
+        while (x != _sentinel)
+        {
+            if (!_comp(x->key, key))
+            {
+                y = x;
+                x = _left(x);
+            }
+            else
+                x = _right(x);
+        }
+        return y;
+    }
+
+    /// @return first node of subtree `x` whose key is greater than `key`,
+    ///         or `y` if there is none
+    template <typename K>
+    pointer _upper_bound (pointer x, pointer y, K const & key) const
+    {
+        while (x != _sentinel)
+        {
+            if (_comp(key, x->key))
+            {
+                y = x;
+                x = _left(x);
+            }
+            else
+                x = _right(x);
+        }
+        return y;
+    }
+
+    /****** Public methods ****************************************************/
+
+    public:
+
+    /// @brief Constructor by default (1)
+    /// @param alloc Allocator of every node, and of the sentinel
+    explicit rb_tree (allocator_type const & alloc = allocator_type())
+    : _alloc(alloc), _sentinel(_create_sentinel()), _root(_sentinel),
+      _size(0) { }
+
+    /// @brief Constructor by copy (2)
+    /// @note The allocator is copied along, as the elements are.
+    rb_tree (rb_tree const & tree)
+    : _alloc(tree._alloc), _sentinel(_create_sentinel()), _root(_sentinel),
+      _size(0)
+    { *this = tree; }
+
+    /// @brief Constructor by copy with another allocator (3)
+    rb_tree (rb_tree const & tree, allocator_type const & alloc)
+    : _alloc(alloc), _sentinel(_create_sentinel()), _root(_sentinel),
+      _size(0)
+    { *this = tree; }
+
+#if __cplusplus >= 201103L
+    /// @brief Constructor by move (4)
+    /// @note `tree` is left empty with a sentinel of its own, from the same
+    ///       allocator, so it stays usable: moving costs that single
+    ///       allocation.
+    rb_tree (rb_tree && tree)
+    : _alloc(tree._alloc), _sentinel(_create_sentinel()), _root(_sentinel),
+      _size(0)
+    { swap(tree); }
+#endif
+
+    /// @brief Iterative destructor
+    ~rb_tree ()
+    {
+        _destroy_all();
+        _destroy_sentinel(Links());
+    }
+
+    /// @brief Insert base routine
+    /// @param z New node to be inserted in the tree
+    void insert (pointer z)
+    {
+        pointer y = _sentinel;
+        pointer x = _root;
+        bool left = true;
+
+        while (x != _sentinel)
+        {
+            y = x;
+            left = _comp(z->key, x->key);
+            x = left ? _left(x) : _right(x);
+        }
+        _link(z, y, left);
+    }
+
+    /// @brief Insert `key` unless an equivalent key is already in the tree
+    /// @return Node holding `key` and whether it has just been inserted
+    /// @note Single descent: the only node that may be equivalent to `key` is
+    ///       the last one we went right from.
+    pair<pointer, bool> insert_unique (key_type const & key)
+    {
+        pointer y = _sentinel;
+        pointer x = _root;
+        pointer e = _sentinel; // last node not greater than `key`
+        bool left = true;
+
+        while (x != _sentinel)
+        {
+            y = x;
+            left = _comp(key, x->key);
+            if (left)
+                x = _left(x);
+            else
+            {
+                e = x;
+                x = _right(x);
+            }
+        }
+        if (e != _sentinel && !_comp(e->key, key))
+            return pair<pointer, bool>(e, false);
+        return _insert_at(y, left, key);
+    }
+
+    /// @brief Insert `key` next to `hint` when it belongs there, otherwise
+    ///        fall back to a full descent
+    /// @param hint Node right after `key` position or the sentinel (end)
+    /// @return Node holding `key` and whether it has just been inserted
+    /// @note When the hint is right, it only costs two comparisons and no
+    ///       descent from the root: sorted loads hinted with the sentinel or
+    ///       with the previously inserted node hit this path every time.
+    pair<pointer, bool> insert_unique (pointer hint, key_type const & key)
+    {
+        pointer y;
+
+        // `key` goes after max node
+        if (hint == _sentinel)
+        {
+            y = _rightmost();
+            if (_size && _comp(y->key, key))
+                return _insert_at(y, false, key);
+        }
+        // `key` goes before `hint`
+        else if (_comp(key, hint->key))
+        {
+            y = _prev(hint);
+            if (y == _sentinel)
+                return _insert_at(hint, true, key);
+            if (_comp(y->key, key))
+                return _right(y) == _sentinel
+                    ? _insert_at(y, false, key)
+                    : _insert_at(hint, true, key);
+        }
+        // `key` goes after `hint`
+        else if (_comp(hint->key, key))
+        {
+            y = _next(hint);
+            if (y == _sentinel)
+                return _insert_at(hint, false, key);
+            if (_comp(key, y->key))
+                return _right(hint) == _sentinel
+                    ? _insert_at(hint, false, key)
+                    : _insert_at(y, true, key);
+        }
+        // `key` is `hint` key
+        else
+            return pair<pointer, bool>(hint, false);
+
+        return insert_unique(key);
+    }
+
+    /// @brief Insert `key` after every equivalent key already in the tree
+    /// @return Node holding `key`
+    pointer insert_equal (key_type const & key)
+    {
+        pointer y = _sentinel;
+        pointer x = _root;
+        bool left = true;
+
+        while (x != _sentinel)
+        {
+            y = x;
+            left = _comp(key, x->key);
+            x = left ? _left(x) : _right(x);
+        }
+        return _insert_at(y, left, key).first;
+    }
+
+    /// @brief Insert `key` as close to `hint` as possible, as std::multimap
+    /// @param hint Node right after `key` position or the sentinel (end)
+    /// @return Node holding `key`
+    /// @note When `key` fits next to `hint`, it only costs two comparisons:
+    ///       sorted loads with duplicates hinted with end() cost no descent.
+    ///       Otherwise `key` goes after its equivalent keys when the hint was
+    ///       after it, before them when the hint was before it.
+    pointer insert_equal (pointer hint, key_type const & key)
+    {
+        pointer y;
+
+        // `key` is not greater than `hint`
+        if (hint == _sentinel || !_comp(hint->key, key))
+        {
+            y = hint == _sentinel ? _rightmost() : _prev(hint);
+            if (y != _sentinel && _comp(key, y->key))
+                return insert_equal(key);
+            if (hint != _sentinel && _left(hint) == _sentinel)
+                return _insert_at(hint, true, key).first;
+            return _insert_at(y, false, key).first;
+        }
+
+        // `key` is greater than `hint`
+        y = _next(hint);
+        if (y != _sentinel && _comp(y->key, key))
+            return _insert_equal_lower(key);
+        if (_right(hint) == _sentinel)
+            return _insert_at(hint, false, key).first;
+        return _insert_at(y, true, key).first;
+    }
+
+    /// @brief Insert range [first, last) of keys
+    /// @note On an empty tree, the sorted prefix of the range (strictly
+    ///       increasing for unique keys) is chained then built bottom-up in
+    ///       O(n) with no comparison but the sortedness check and no
+    ///       rebalancing. Whatever comes after (or the whole range on a
+    ///       non-empty tree) is inserted with an end hint, so sorted appends
+    ///       stay cheap too.
+    template <typename InputIterator>
+    void insert_range (InputIterator first, InputIterator last)
+    {
+        if (empty())
+        {
+            pointer head = _sentinel;
+            pointer tail = _sentinel;
+            size_type n = 0;
+            size_type red_depth = 0;
+
+            for (; first != last; ++first)
+            {
+                // converted once, so lookups by other key types don't kick in
+                key_type const & key = *first;
+
+                if (n && (Duplicates::multi ? _comp(key, tail->key)
+                                            : !_comp(tail->key, key)))
+                    break;
+                pointer z = _create_node(key);
+                _set_right(z, _sentinel);
+                if (n)
+                    _set_right(tail, z);
+                else
+                    head = z;
+                tail = z;
+                n++;
+            }
+            if (n)
+            {
+                while ((static_cast<size_type>(2) << red_depth) <= n + 1)
+                    red_depth++;
+                _root = _build(head, n, 0, red_depth);
+                _set_parent(_root, _sentinel);
+                _root->set_color(Black);
+                _size = n;
+                _reset_bounds();
+            }
+        }
+        for (; first != last; ++first)
+        {
+            if (Duplicates::multi)
+                insert_equal(sentinel(), *first);
+            else
+                insert_unique(sentinel(), *first);
+        }
+    }
+
+    /// @brief Insert by key, as the duplicate policy says
+    /// @param key Key of the new node inserted
+    void insert (key_type const & key)
+    {
+        if (Duplicates::multi)
+            insert_equal(key);
+        else
+            insert_unique(key);
     }
 
     /// @brief Insert by value
     void insert (value_type const & val)
     { return insert(val.key); }
 
+#if __cplusplus >= 201103L
+    /// @brief Build a key out of `args` right in a new node, and keep it
+    ///        unless an equivalent key is already in the tree
+    /// @return Node holding the key and whether it has just been inserted
+    /// @note The key has to exist before it can be compared, so a duplicate
+    ///       costs a node built and destroyed. Lookup first when that matters.
+    template <typename... Args>
+    pair<pointer, bool> emplace_unique (Args &&... args)
+    {
+        pointer z = _emplace_node(std::forward<Args>(args)...);
+        pointer p = lower_bound(z->key);
+
+        if (p != _sentinel && !_comp(z->key, p->key))
+        {
+            _destroy_node(z);
+            return pair<pointer, bool>(p, false);
+        }
+        return pair<pointer, bool>(_link_before(p, z), true);
+    }
+
+    /// @brief Build a key out of `args` right in a new node linked before
+    ///        `pos`, with no comparison
+    /// @pre The key belongs right before `pos`, e.g. `pos` is the lower bound
+    ///      of a key missing from a unique keys tree
+    template <typename... Args>
+    pointer emplace_before (pointer pos, Args &&... args)
+    { return _link_before(pos, _emplace_node(std::forward<Args>(args)...)); }
+#endif
+
     /// @brief Erase base routine
     /// @todo private/protected ?
     void erase (pointer z)
+    { _destroy_node(extract(z)); }
+
+    /// @brief Unlink node `z` from the tree, without destroying it
+    /// @return `z`, detached: the caller owns it from now on
+    /// @note Nodes never swap keys when unlinked, so every other node stays
+    ///       where it is in memory and pointers to them remain valid.
+    pointer extract (pointer z)
     {
         pointer x;
         pointer y = z;
-        color_type c = y->color;
+        color_type c = y->color();
 
-        if (z->left == &_sentinel)
+        if (z == _leftmost())
+            _set_left(_sentinel, _next(z));
+        if (z == _rightmost())
+            _set_right(_sentinel, _prev(z));
+
+        if (_left(z) == _sentinel)
         {
-            x = z->right;
-            _transplant(z, z->right);
+            x = _right(z);
+            _transplant(z, _right(z));
         }
-        else if (z->right == &_sentinel)
+        else if (_right(z) == _sentinel)
         {
-            x = z->left;
-            _transplant(z, z->left);
+            x = _left(z);
+            _transplant(z, _left(z));
         }
         else
         {
-            y = min(z->right);
-            c = y->color;
-            x = y->right;
-            if (y->parent == z)
-                x->parent = y;
+            y = min(_right(z));
+            c = y->color();
+            x = _right(y);
+            if (_parent(y) == z)
+                _set_parent(x, y);
             else
             {
-                _transplant(y, y->right);
-                y->right = z->right;
-                y->right->parent = y;
+                _transplant(y, _right(y));
+                _set_right(y, _right(z));
+                _set_parent(_right(y), y);
             }
             _transplant(z, y);
-            y->left = z->left;
-            y->left->parent = y;
-            y->color = z->color;
+            _set_left(y, _left(z));
+            _set_parent(_left(y), y);
+            y->set_color(z->color());
         }
+        _update_path(_parent(x));
         if (c == Black)
             _erase_fixup(x);
-        _alloc.destroy(z);
-        _alloc.deallocate(z, 1);
         _size--;
+        return z;
+    }
+
+    /// @brief Link detached node `z` unless an equivalent key is already in
+    /// @return Node holding the key and whether `z` has been linked. When it
+    ///         has not, the caller still owns `z`.
+    /// @pre Unique keys tree. `z` was allocated by a tree of the same type,
+    ///      with an allocator equal to this one.
+    pair<pointer, bool> insert_unique_node (pointer z)
+    {
+        movable_nodes();
+        pointer p = lower_bound(z->key);
+
+        if (p != _sentinel && !_comp(z->key, p->key))
+            return pair<pointer, bool>(p, false);
+        return pair<pointer, bool>(_link_before(p, z), true);
+    }
+
+    /// @brief Move every node of `other` whose key is not in this tree yet
+    ///        over here, as `std::map::merge`
+    /// @note Nodes are relinked as they are: no allocation, no key copied.
+    ///       Nodes of keys already in stay in `other`. When allocators
+    ///       differ, a node must go back to its own: keys are then copied
+    ///       into nodes of this tree and erased from `other` instead.
+    /// @pre Unique keys trees
+    void merge_unique (rb_tree & other)
+    {
+        movable_nodes();
+        if (&other == this)
+            return;
+
+        bool relink = _alloc == other._alloc;
+        pointer x = other._leftmost();
+        while (x != other._sentinel)
+        {
+            pointer next = other._next(x);
+            pointer p = lower_bound(x->key);
+
+            if (p == _sentinel || _comp(x->key, p->key))
+            {
+                if (relink)
+                    _link_before(p, other.extract(x));
+                else
+                {
+                    _link_before(p, _create_node(x->key));
+                    other.erase(x);
+                }
+            }
+            x = next;
+        }
     }
 
     /// @brief Erase by key
-    void erase (key_type const & key)
-    { pointer x = find(_root, key); if (x) erase(x); }
+    /// @return Number of nodes erased (0 or 1 for unique keys)
+    template <typename K>
+    size_type erase (K const & key)
+    {
+        if (Duplicates::multi)
+        {
+            size_type n = _size;
+            pair<pointer, pointer> range = equal_range(key);
+            erase(range.first, range.second);
+            return n - _size;
+        }
 
-    pointer find (pointer x, key_type const & key) const
+        pointer x = find(_root, key);
+        if (x == NULL)
+            return 0;
+        erase(x);
+        return 1;
+    }
+
+    /// @brief Erase nodes in range [first, last)
+    /// @note Short ranges are erased node by node. Longer ones are cut out of
+    ///       the tree with two splits and one join, so rebalancing costs
+    ///       O(log n) whatever the length of the range, then freed in one
+    ///       post-order walk. Equivalent keys can't be told apart by a
+    ///       split, so trees of equal keys always erase node by node.
+    void erase (pointer first, pointer last)
     {
-        while (x != &_sentinel && (_comp(key, x->key) || _comp(x->key, key)))
-            _comp(key, x->key) ? x = x->left : x = x->right;
-        return x != &_sentinel ? x : NULL;
+        pointer x = first;
+        size_type h = _black_height(_root);
+        size_type n = 0;
+
+        if (first == _leftmost() && last == _sentinel)
+            return clear();
+
+        // short range
+        while (x != last && (n <= h || Duplicates::multi))
+        {
+            x = _next(x);
+            n++;
+        }
+        if (x == last)
+        {
+            while (first != last)
+            {
+                x = _next(first);
+                erase(first);
+                first = x;
+            }
+            return;
+        }
+
+        // long range: `l` < `first` <= `mid` < `last` <= `r`
+        pointer l, mid, r;
+        size_type hl, hmid, hr;
+
+        _split(_root, h, first->key, l, hl, r, hr);
+        if (last == _sentinel)
+        {
+            mid = r;
+            r = _sentinel;
+            _root = l;
+        }
+        else
+        {
+            _split(r, hr, last->key, mid, hmid, r, hr);
+            _root = _join(l, hl, last, r, hr, h);
+        }
+        _set_parent(_root, _sentinel);
+        _reset_bounds();
+        _size -= _destroy(mid) + 1;
+        _destroy_node(first);
+    }
+
+    /// @brief Destroy every node in a single post-order walk, no rebalancing
+    void clear ()
+    {
+        _destroy_all();
+        _release_slabs(Links());
+        _root = _sentinel;
+        _size = 0;
+        _reset_bounds();
+    }
+
+    /// @brief Move every key greater than `key` to `right`, whose previous
+    ///        content is destroyed
+    /// @note Cutting the tree costs O(log n). Each moved node must then be
+    ///       re-pointed to the sentinel of `right`, once.
+    void split (key_type const & key, rb_tree & right)
+    {
+        movable_nodes();
+        pointer l, m, r;
+        size_type hl, hr;
+
+        if (this == &right)
+            return;
+        right.clear();
+        m = _split(_root, _black_height(_root), key, l, hl, r, hr);
+        if (m != _sentinel)
+            l = _join(l, hl, m, _sentinel, 0, hl);
+        _set_root(l);
+        if (r != _sentinel)
+        {
+            right._size = right._adopt(r, _sentinel);
+            right._set_root(r);
+            _size -= right._size;
+        }
+    }
+
+    /// @brief Move every node of `right` at the end of this tree
+    /// @pre Every key of this tree is less than every key of `right`
+    /// @note Gluing both trees costs O(log n). Nodes of the smaller tree must
+    ///       first be re-pointed to the sentinel of the bigger one, once.
+    void join (rb_tree & right)
+    {
+        movable_nodes();
+        pointer l = _root;
+        pointer r = right._root;
+        size_type h;
+
+        if (this == &right || right.empty())
+            return;
+        if (empty())
+            return swap(right);
+        if (_size < right._size)
+        {
+            swap(right);
+            _adopt(l, right._sentinel);
+        }
+        else
+            _adopt(r, right._sentinel);
+        _size += right._size;
+        right._size = 0;
+        right._set_root(right._sentinel);
+        _set_parent(l, _sentinel);
+        _set_parent(r, _sentinel);
+        _set_root(_join2(l, _black_height(l), r, _black_height(r), h));
+    }
+
+    /// @brief Insert a copy of every node of `t` whose key is missing here
+    void merge_union (rb_tree const & t)
+    {
+        size_type h;
+
+        if (this == &t)
+            return;
+        _set_root(_union(_root, _black_height(_root), t._root,
+                         t._black_height(t._root), t._sentinel, h));
+    }
+
+    /// @brief Erase every node whose key is missing in `t`
+    void intersection (rb_tree const & t)
+    {
+        size_type h;
+
+        if (this == &t)
+            return;
+        _set_root(_intersection(_root, _black_height(_root), t._root,
+                                t._black_height(t._root), t._sentinel, h));
+    }
+
+    /// @brief Erase every node whose key is in `t`
+    void difference (rb_tree const & t)
+    {
+        size_type h;
+
+        if (this == &t)
+            return clear();
+        _set_root(_difference(_root, _black_height(_root), t._root,
+                              t._black_height(t._root), t._sentinel, h));
     }
 
-    pointer find (key_type const & key) const
+    /**
+     *  Lookups
+     *
+     *  Keys are searched as `K`, compared to node keys by `compare_type`
+     *  both ways round: `key_type` itself, or what the comparison also
+     *  accepts, such as the key part alone of a map element. No node key is
+     *  built to look one up.
+     */
+
+    /// @note One comparison per level: descend as lower_bound then check the
+    ///       candidate once at the end.
+    template <typename K>
+    pointer find (pointer x, K const & key) const
+    {
+        x = _lower_bound(x, sentinel(), key);
+        return x != _sentinel && !_comp(key, x->key) ? x : NULL;
+    }
+
+    template <typename K>
+    pointer find (K const & key) const
     { return find(_root, key); }
 
+    /// @brief Find up to `batch_width` keys of [first, last) at once
+    /// @param found Receives a node per key looked up, the sentinel if
+    ///        missing
+    /// @return Iterator on the first key not looked up
+    /// @note The descents run in lockstep, one level each per round, the
+    ///       next node of each prefetched meanwhile: the cache misses of
+    ///       independent lookups overlap instead of stalling one by one.
+    ///       Keys stay where `first` points, hence forward iterators.
+    template <typename ForwardIt>
+    ForwardIt find_batch (ForwardIt first, ForwardIt last, pointer * found) const
+    {
+        ForwardIt   keys[batch_width];
+        pointer     x[batch_width];
+        size_t      n = 0;
+
+        for (; n < batch_width && first != last; ++first, ++n)
+        {
+            keys[n] = first;
+            x[n] = _root;
+            found[n] = sentinel();
+        }
+        for (bool descending = true; descending; )
+        {
+            descending = false;
+            for (size_t i = 0; i < n; i++)
+            {
+                if (x[i] == _sentinel)
+                    continue;
+                if (!_comp(x[i]->key, *keys[i]))
+                {
+                    found[i] = x[i];
+                    x[i] = _left(x[i]);
+                }
+                else
+                    x[i] = _right(x[i]);
+                _prefetch(x[i]);
+                descending = true;
+            }
+        }
+        for (size_t i = 0; i < n; i++)
+            if (found[i] != _sentinel && _comp(*keys[i], found[i]->key))
+                found[i] = sentinel();
+        return first;
+    }
+
+    /// @return first node whose key is not less than `key`, or the sentinel
+    template <typename K>
+    pointer lower_bound (K const & key) const
+    { return _lower_bound(_root, sentinel(), key); }
+
+    /// @return first node whose key is greater than `key`, or the sentinel
+    template <typename K>
+    pointer upper_bound (K const & key) const
+    { return _upper_bound(_root, sentinel(), key); }
+
+    /// @brief Lower and upper bounds of `key` in a single descent
+    /// @note Once a node equal to `key` is met, both bounds lie in its left
+    ///       and right subtrees respectively.
+    template <typename K>
+    pair<pointer, pointer> equal_range (K const & key) const
+    {
+        pointer x = _root;
+        pointer y = sentinel();
+
+        while (x != _sentinel)
+        {
+            if (_comp(x->key, key))
+                x = _right(x);
+            else if (_comp(key, x->key))
+            {
+                y = x;
+                x = _left(x);
+            }
+            else
+                return pair<pointer, pointer>(_lower_bound(_left(x), x, key),
+                                              _upper_bound(_right(x), y, key));
+        }
+        return pair<pointer, pointer>(y, y);
+    }
+
+    /// @return Number of nodes equivalent to `key`, in O(log n + k)
+    template <typename K>
+    size_type count (K const & key) const
+    {
+        pair<pointer, pointer> range = equal_range(key);
+        size_type n = 0;
+
+        for (pointer x = range.first; x != range.second; x = _next(x))
+            n++;
+        return n;
+    }
+
+    /// @brief Refresh the summaries above `x`, whose key has just changed in
+    ///        place without moving in the order
+    void refresh (pointer x)
+    { _update_path(x); }
+
+    /**
+     *  Order statistics
+     *
+     *  Only available with the `rb_order_statistics` augmentation: each one
+     *  descends once, reading subtree sizes on the way, in O(log n).
+     */
+
+    /// @return Node of rank `k` (0 for the min), or the sentinel if `k` is
+    ///         not less than the size
+    pointer select (size_type k) const
+    {
+        pointer x = _root;
+
+        while (x != _sentinel)
+        {
+            if (k < _left(x)->size)
+                x = _left(x);
+            else if (k == _left(x)->size)
+                return x;
+            else
+            {
+                k -= _left(x)->size + 1;
+                x = _right(x);
+            }
+        }
+        return sentinel();
+    }
+
+    /// @return Number of keys less than `key`
+    template <typename K>
+    size_type rank (K const & key) const
+    {
+        pointer x = _root;
+        size_type n = 0;
+
+        while (x != _sentinel)
+        {
+            if (_comp(x->key, key))
+            {
+                n += _left(x)->size + 1;
+                x = _right(x);
+            }
+            else
+                x = _left(x);
+        }
+        return n;
+    }
+
+    /// @return Number of keys in [lo, hi)
+    template <typename K>
+    size_type count_range (K const & lo, K const & hi) const
+    {
+        size_type l = rank(lo);
+        size_type h = rank(hi);
+        return h > l ? h - l : 0;
+    }
+
+    /**
+     *  Range aggregates
+     *
+     *  Only available with an `rb_monoid` augmentation.
+     */
+
+    typedef typename Augment::summary_type summary_type;
+
+    /// @return Fold of every key, in O(1)
+    summary_type aggregate () const
+    { return _root->summary; }
+
+    /// @return Fold of the keys in [lo, hi), in order
+    /// @note Descends to the first node in range, the fork of both bounds
+    ///       paths, then folds whole subtrees hanging inside the range along
+    ///       each path: O(log n).
+    template <typename K>
+    summary_type aggregate (K const & lo, K const & hi) const
+    {
+        typedef typename Augment::monoid_type monoid;
+
+        pointer x = _root;
+        pointer y;
+        summary_type left = monoid::identity();
+        summary_type right = monoid::identity();
+
+        while (x != _sentinel)
+        {
+            if (!_comp(x->key, hi))
+                x = _left(x);
+            else if (_comp(x->key, lo))
+                x = _right(x);
+            else
+                break;
+        }
+        if (x == _sentinel)
+            return left;
+        // keys not less than `lo` in the left subtree
+        for (y = _left(x); y != _sentinel; )
+        {
+            if (_comp(y->key, lo))
+                y = _right(y);
+            else
+            {
+                left = monoid::combine(monoid::combine(
+                    monoid::measure(y->key), _right(y)->summary), left);
+                y = _left(y);
+            }
+        }
+        // keys less than `hi` in the right subtree
+        for (y = _right(x); y != _sentinel; )
+        {
+            if (!_comp(y->key, hi))
+                y = _left(y);
+            else
+            {
+                right = monoid::combine(right, monoid::combine(
+                    _left(y)->summary, monoid::measure(y->key)));
+                y = _right(y);
+            }
+        }
+        return monoid::combine(
+            monoid::combine(left, monoid::measure(x->key)), right);
+    }
+
     /// @note is it very useful ?...
     pointer min (pointer x) const
     {
-        while (x != &_sentinel && x->left != &_sentinel) x = x->left;
+        while (x != _sentinel && _left(x) != _sentinel) x = _left(x);
         return x;
     }
 
     /// @note is it very useful ?...
     pointer max (pointer x) const
     {
-        while (x != &_sentinel && x->right != &_sentinel) x = x->right;
+        while (x != _sentinel && _right(x) != _sentinel) x = _right(x);
         return x;
     }
 
+    /// @note The tree keeps its allocator: copies of the elements of `rhs`
+    ///       are allocated by it.
+    /// @note As with `clear`, slabs go back first: an arena would never
+    ///       reuse the room of the previous elements.
     rb_tree & operator= (rb_tree const & rhs)
     {
-        _destroy(_root);
-        if (rhs.empty())
-        {
-            _root = &_sentinel;
-            _size = 0;
-        }
-        else
-        {
-            _root = _copy(rhs.root(), rhs.sentinel());
-            _size = rhs.size();
-        }
-        _sentinel.left = _root;
-        _sentinel.right = _root;
-        _sentinel.parent = _root;
+        if (this == &rhs)
+            return *this;
+        clear();
+        _root = _copy(rhs.root(), rhs.sentinel());
+        _reset_bounds();
+        _set_parent(_sentinel, _root);
+        return *this;
+    }
+
+#if __cplusplus >= 201103L
+    /// @note Nodes are taken over from `rhs`, so is its allocator. Ours
+    ///       and our slabs are released first, rather than handed to `rhs`.
+    rb_tree & operator= (rb_tree && rhs)
+    {
+        if (this == &rhs)
+            return *this;
+        clear();
+        swap(rhs);
         return *this;
     }
+#endif
+
+    /// @brief Exchange contents in O(1)
+    /// @note Both sentinels are exchanged along with the nodes hanging from
+    ///       them, so iterators keep pointing into the same nodes. So are
+    ///       the allocators, as the nodes must go back to their own.
+    void swap (rb_tree & t)
+    {
+        pointer sentinel = _sentinel;
+        pointer root = _root;
+        size_type size = _size;
+        compare_type comp = _comp;
+
+        _sentinel = t._sentinel;
+        _root = t._root;
+        _size = t._size;
+        _comp = t._comp;
+
+        t._sentinel = sentinel;
+        t._root = root;
+        t._size = size;
+        t._comp = comp;
+
+        std::swap(_alloc, t._alloc);
+    }
 
     size_type size () const
     { return _size; }
 
+    /// @note Index links address 2^32 nodes, the first slab of 1024 being
+    ///       the sentinel's alone. Counted down from the greatest 32-bit
+    ///       index, which fits a 32-bit `size_type` too.
     size_type max_size () const
-    { return _alloc.max_size(); }
+    {
+        size_type indexes = size_type(std::numeric_limits<unsigned int>::max())
+                          - 1023;
+
+        if (Links::indexed && indexes < _alloc.max_size())
+            return indexes;
+        return _alloc.max_size();
+    }
 
     bool empty () const
     { return _size == 0; }
@@ -565,7 +2590,33 @@ class rb_tree
     { return _root; }
 
     pointer sentinel () const
-    { return const_cast<pointer>(&_sentinel); }
+    { return _sentinel; }
+
+    /// @brief Compiles only when nodes can move to another tree: pointer
+    ///        links and heap storage
+    static void movable_nodes ()
+    {
+        Links::movable_nodes();
+        Storage::movable_nodes();
+    }
+
+    /// @brief Min node, in O(1), or the sentinel when empty
+    pointer leftmost () const
+    { return _leftmost(); }
+
+    /// @brief Max node, in O(1), or the sentinel when empty
+    pointer rightmost () const
+    { return _rightmost(); }
+
+    /// @brief Links of node `x`, to walk the tree from outside
+    pointer left (pointer x) const
+    { return _left(x); }
+
+    pointer right (pointer x) const
+    { return _right(x); }
+
+    pointer parent (pointer x) const
+    { return _parent(x); }
 
     /****** Debug *************************************************************/
 
@@ -585,16 +2636,16 @@ class rb_tree
 //    private: void _draw_graph (std::ofstream & file, pointer node) const
 //    {
 //        file << node->key << "; style " << node->key << " fill:";
-//        node->color == Red ? file << "red" : file << "black";
+//        node->color() == Red ? file << "red" : file << "black";
 //        file << std::endl;
 //
-//        if (node->left != &_sentinel)
+//        if (node->left != _sentinel)
 //        {
 //            file << node->key << " --- " << node->left->key << std::endl;
 //            _draw_graph(file, node->left);
 //        } else file << node->key << " --- sentinel" << std::endl;
 //
-//        if (node->right != &_sentinel)
+//        if (node->right != _sentinel)
 //        {
 //            file << node->key << " --- " << node->right->key << std::endl;
 //            _draw_graph(file, node->right);
@@ -604,19 +2655,19 @@ class rb_tree
     private: void _draw_graph_pair (std::ofstream & file, pointer node) const
     {
         file << node->key.first << "; style " << node->key.first << " fill:";
-        node->color == Red ? file << "red" : file << "black";
+        node->color() == Red ? file << "red" : file << "black";
         file << std::endl;
 
-        if (node->left != &_sentinel)
+        if (_left(node) != _sentinel)
         {
-            file << (node->key).first << " --- " << node->left->key.first << std::endl;
-            _draw_graph_pair(file, node->left);
+            file << (node->key).first << " --- " << _left(node)->key.first << std::endl;
+            _draw_graph_pair(file, _left(node));
         } else file << (node->key).first << " --- sentinel" << std::endl;
 
-        if (node->right != &_sentinel)
+        if (_right(node) != _sentinel)
         {
-            file << (node->key).first << " --- " << node->right->key.first << std::endl;
-            _draw_graph_pair(file, node->right);
+            file << (node->key).first << " --- " << _right(node)->key.first << std::endl;
+            _draw_graph_pair(file, _right(node));
         } else file << (node->key).first << " --- sentinel" << std::endl;
     }
 
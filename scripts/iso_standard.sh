@@ -15,9 +15,21 @@ iso_standard()
     // utility
     #include "ft_pair.hpp"
     #include "rb_tree.hpp"
+    #include "btree.hpp"
+    #include "ft_hash.hpp"
+    #include "hash_table.hpp"
 
     // containers
     #include "ft_map.hpp"
+    #include "ft_interval_map.hpp"
+    #include "ft_btree_map.hpp"
+    #include "ft_btree_set.hpp"
+    #include "ft_flat_map.hpp"
+    #include "ft_unordered_map.hpp"
+    #include "ft_unordered_set.hpp"
+    #include "ft_set.hpp"
+    #include "ft_multiset.hpp"
+    #include "ft_multimap.hpp"
     #include "ft_vector.hpp"
     #include "ft_stack.hpp"
 
@@ -28,6 +40,9 @@ iso_standard()
     // iterators
     #include "ft_type_traits.hpp"
     #include "ft_iterator_base_types.hpp"
+    #include "ft_rb_tree_iterator.hpp"
+    #include "ft_btree_iterator.hpp"
+    #include "ft_hash_table_iterator.hpp"
 
     // traits
     #include "ft_type_traits.hpp"
@@ -0,0 +1,316 @@
+#include <map>
+#include <set>
+#include <vector>
+
+#include "utils.hpp"
+#include "ft_btree_map.hpp"
+#include "ft_btree_set.hpp"
+
+///@note Expected results come from std::map and std::set fed with the same
+///      operations. Keys are drawn from a small range so that inserts and
+///      erases hit existing keys, and nodes split and merge all along.
+
+template <typename BtreeMap, typename StdMap>
+bool same_content(BtreeMap const & m, StdMap const & s)
+{
+    typename BtreeMap::const_iterator it = m.begin();
+    typename StdMap::const_iterator sit = s.begin();
+
+    if (m.size() != s.size())
+        return false;
+    for (; sit != s.end(); ++it, ++sit)
+        if (it == m.end() || it->first != sit->first || it->second != sit->second)
+            return false;
+    if (it != m.end())
+        return false;
+    // and backward, through every node boundary
+    while (sit != s.begin())
+        if ((--it)->first != (--sit)->first)
+            return false;
+    return it == m.begin();
+}
+
+/****** Constructors test *****************************************************/
+
+template <typename Map>
+void constructors_test()
+{
+    typedef typename Map::value_type value_type;
+    {
+        // by default
+        Map m;
+        expect(m.empty());
+        expect(m.size() == 0);
+        expect(m.begin() == m.end());
+    }
+    {
+        // by range, then by copy
+        std::vector<value_type> v;
+        for (int i = 0; i < 1000; i++)
+            v.push_back(value_type((i * 7919) % 500, i));
+
+        Map m(v.begin(), v.end());
+        expect(m.size() == 500);
+        expect(m.begin()->first == 0);
+        expect(m.rbegin()->first == 499);
+
+        Map c(m);
+        expect(c == m);
+        c.erase(250);
+        expect(c != m);
+        expect(m < c);
+        c = m;
+        expect(c == m);
+    }
+    log("constructors");
+}
+
+/****** Modifiers test ********************************************************/
+
+template <typename Map>
+void modifiers_test()
+{
+    Map m;
+    std::map<int,int> s;
+    bool ok = true;
+
+    std::srand(42);
+    for (int i = 0; i < 20000; i++)
+    {
+        int key = std::rand() % 3000;
+        switch (std::rand() % 4)
+        {
+            case 0:
+            case 1:
+                ok = ok && m.insert(ft::make_pair(key, i)).second
+                    == s.insert(std::make_pair(key, i)).second;
+                break;
+            case 2:
+                ok = ok && m.erase(key) == s.erase(key);
+                break;
+            default:
+                m[key] = i;
+                s[key] = i;
+        }
+        // the first and last leaves are kept track of
+        ok = ok && (m.begin() == m.end()) == s.empty();
+        ok = ok && (s.empty() || (m.begin()->first == s.begin()->first
+                                  && (--m.end())->first == s.rbegin()->first));
+        if (i % 1000 == 0)
+            ok = ok && same_content(m, s);
+    }
+    expect(ok);
+    expect(same_content(m, s));
+
+    // erase by position and by range
+    m.erase(m.find(s.begin()->first));
+    s.erase(s.begin());
+    m.erase(m.lower_bound(1000), m.lower_bound(2000));
+    s.erase(s.lower_bound(1000), s.lower_bound(2000));
+    expect(same_content(m, s));
+
+    // sorted load through the end hint
+    Map h;
+    for (int i = 0; i < 5000; i++)
+        h.insert(h.end(), ft::make_pair(i, i));
+    expect(h.size() == 5000);
+    expect((--h.end())->first == 4999);
+
+    h.swap(m);
+    expect(same_content(h, s));
+    m.clear();
+    expect(m.empty());
+    log("insert() erase() operator[] swap() clear()");
+}
+
+/// @brief Mapped type counting its copies, moves being free
+struct copy_counted
+{
+    static int copies;
+
+    int value;
+
+    copy_counted (int v = 0) : value(v) { }
+    copy_counted (copy_counted const & c) : value(c.value) { copies++; }
+    copy_counted (copy_counted && c) : value(c.value) { }
+
+    copy_counted & operator= (copy_counted const & c)
+    { value = c.value; copies++; return *this; }
+};
+
+int copy_counted::copies = 0;
+
+/// @note ft only: values are moved, never copied, as nodes split, borrow
+///       and merge: each insert copies its value once and erases none
+void moves_test()
+{
+    typedef ft::btree_map<int, copy_counted> counted_map;
+
+    counted_map m;
+    int inserted = 0;
+    int copies = 0;
+
+    std::srand(42);
+    for (int i = 0; i < 20000; i++)
+    {
+        counted_map::value_type v(std::rand() % 3000, copy_counted(i));
+        int before = copy_counted::copies;
+        if (std::rand() % 3)
+            inserted += m.insert(v).second;
+        else
+            m.erase(v.first);
+        copies += copy_counted::copies - before;
+    }
+    expect(copies == inserted);
+    log("moves");
+}
+
+/// @brief std::allocator telling its copies apart by `id`, and keeping
+///        count of the bytes they hold in `*live`
+template <typename T>
+struct counting_allocator : public std::allocator<T>
+{
+    template <typename U>
+    struct rebind { typedef counting_allocator<U> other; };
+
+    int     id;
+    long *  live;
+
+    counting_allocator (int id = 0, long * live = NULL)
+    : id(id), live(live) { }
+
+    template <typename U>
+    counting_allocator (counting_allocator<U> const & a)
+    : std::allocator<T>(), id(a.id), live(a.live) { }
+
+    T * allocate (std::size_t n)
+    {
+        if (live)
+            *live += static_cast<long>(n * sizeof(T));
+        return std::allocator<T>::allocate(n);
+    }
+
+    void deallocate (T * p, std::size_t n)
+    {
+        if (live)
+            *live -= static_cast<long>(n * sizeof(T));
+        std::allocator<T>::deallocate(p, n);
+    }
+};
+
+/// @note Every node comes from the allocator given, and goes back to it,
+///       swaps included
+template <typename Map>
+void allocator_test()
+{
+    typedef typename Map::allocator_type allocator_type;
+
+    long live_a = 0;
+    long live_b = 0;
+    {
+        Map a(std::less<int>(), allocator_type(1, &live_a));
+        Map b(std::less<int>(), allocator_type(2, &live_b));
+        for (int i = 0; i < 3000; i++)
+            a.insert(ft::make_pair(i, i));
+        expect(live_a > 0 && live_b == 0);
+        expect(a.get_allocator().id == 1);
+
+        Map c(a);
+        expect(c.get_allocator().id == 1);
+        a.swap(b);
+        expect(a.get_allocator().id == 2 && b.get_allocator().id == 1);
+        b.erase(b.begin(), b.find(2000));
+        a.insert(ft::make_pair(0, 0));
+        expect(b.size() == 1000 && live_b > 0);
+    }
+    expect(live_a == 0 && live_b == 0);
+    log("get_allocator()");
+}
+
+/****** Operations test *******************************************************/
+
+template <typename Map>
+void operations_test()
+{
+    Map m;
+    std::map<int,int> s;
+    bool ok = true;
+
+    for (int i = 0; i < 3000; i += 3)
+    {
+        m.insert(ft::make_pair(i, i));
+        s.insert(std::make_pair(i, i));
+    }
+    Map const & cm = m;
+    for (int key = -5; key < 3010; key++)
+    {
+        typename Map::const_iterator lb = cm.lower_bound(key);
+        typename Map::const_iterator ub = cm.upper_bound(key);
+        std::map<int,int>::iterator slb = s.lower_bound(key);
+        std::map<int,int>::iterator sub = s.upper_bound(key);
+
+        ok = ok && (lb == cm.end()) == (slb == s.end());
+        ok = ok && (lb == cm.end() || lb->first == slb->first);
+        ok = ok && (ub == cm.end()) == (sub == s.end());
+        ok = ok && (ub == cm.end() || ub->first == sub->first);
+        ok = ok && cm.count(key) == s.count(key);
+        ok = ok && (m.find(key) == m.end()) == (s.find(key) == s.end());
+        ok = ok && m.equal_range(key).first == m.lower_bound(key);
+        ok = ok && m.equal_range(key).second == m.upper_bound(key);
+    }
+    expect(ok);
+    log("find() count() lower_bound() upper_bound() equal_range()");
+}
+
+/****** Set test **************************************************************/
+
+template <typename Set>
+void set_test()
+{
+    Set m;
+    std::set<int> s;
+    bool ok = true;
+
+    std::srand(42);
+    for (int i = 0; i < 20000; i++)
+    {
+        int key = std::rand() % 3000;
+        if (std::rand() % 3)
+            ok = ok && m.insert(key).second == s.insert(key).second;
+        else
+            ok = ok && m.erase(key) == s.erase(key);
+    }
+    expect(ok);
+    expect(m.size() == s.size());
+    expect(std::equal(s.begin(), s.end(), m.begin()));
+    expect(std::equal(s.rbegin(), s.rend(), m.rbegin()));
+    expect(*m.lower_bound(1500) == *s.lower_bound(1500));
+
+    Set c(m);
+    expect(c == m);
+    c.erase(c.begin(), c.find(*s.rbegin()));
+    expect(c.size() == 1);
+    log("btree_set");
+}
+
+/****** Btree map test ********************************************************/
+
+template <typename T>
+void btree_map_test()
+{
+    constructors_test< ft::btree_map<int,T> >();
+    modifiers_test< ft::btree_map<int,T> >();
+    operations_test< ft::btree_map<int,T> >();
+    set_test< ft::btree_set<int> >();
+    moves_test();
+    allocator_test< ft::btree_map<int,T,std::less<int>,
+                    counting_allocator<ft::pair<const int,T> > > >();
+}
+
+/****** All tests *************************************************************/
+
+int main()
+{
+    btree_map_test<int>();
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include <map>
+#include <vector>
+
+#include "utils.hpp"
+#include "ft_flat_map.hpp"
+
+///@note Expected results come from a std::map fed with the same operations.
+
+template <typename FlatMap>
+bool same_content(FlatMap const & m, std::map<int,int> const & s)
+{
+    typename FlatMap::const_iterator it = m.begin();
+    std::map<int,int>::const_iterator sit = s.begin();
+
+    if (m.size() != s.size())
+        return false;
+    for (; sit != s.end(); ++it, ++sit)
+        if (it->first != sit->first || it->second != sit->second)
+            return false;
+    return true;
+}
+
+/****** Constructors test *****************************************************/
+
+template <typename FlatMap>
+void constructors_test()
+{
+    typedef typename FlatMap::value_type value_type;
+    {
+        // by default
+        FlatMap m;
+        expect(m.empty());
+        expect(m.size() == 0);
+        expect(m.begin() == m.end());
+    }
+    {
+        // by range, keeping the first of equal keys, then by copy
+        std::vector<value_type> v;
+        for (int i = 0; i < 1000; i++)
+            v.push_back(value_type((i * 7919) % 500, i));
+
+        FlatMap m(v.begin(), v.end());
+        expect(m.size() == 500);
+        expect(m.begin()->first == 0);
+        expect(m.begin()->second == 0);
+        expect(m.rbegin()->first == 499);
+        expect(m.find(7919 % 500)->second == 1);
+
+        FlatMap c(m);
+        expect(c == m);
+        c.erase(250);
+        expect(c != m);
+        expect(m < c);
+        c = m;
+        expect(c == m);
+    }
+    log("constructors");
+}
+
+/****** Modifiers test ********************************************************/
+
+template <typename FlatMap>
+void modifiers_test()
+{
+    typedef typename FlatMap::value_type value_type;
+
+    FlatMap m;
+    std::map<int,int> s;
+    bool ok = true;
+
+    std::srand(42);
+    for (int i = 0; i < 5000; i++)
+    {
+        int key = std::rand() % 1000;
+        switch (std::rand() % 5)
+        {
+            case 0:
+                ok = ok && m.insert(value_type(key, i)).second
+                    == s.insert(std::make_pair(key, i)).second;
+                break;
+            case 1:
+                ok = ok && m.erase(key) == s.erase(key);
+                break;
+            case 2:
+                m[key] = i;
+                s[key] = i;
+                break;
+            case 3:
+            {
+                // batch insert, merged with what is already there
+                std::vector<value_type> v;
+                for (int j = 0; j < 20; j++)
+                    v.push_back(value_type(std::rand() % 1000, i));
+                m.insert(v.begin(), v.end());
+                for (int j = 0; j < 20; j++)
+                    s.insert(std::make_pair(v[j].first, v[j].second));
+                break;
+            }
+            default:
+                m.insert(m.lower_bound(key), value_type(key, i));
+                s.insert(std::make_pair(key, i));
+        }
+    }
+    expect(ok);
+    expect(same_content(m, s));
+
+    // erase by position and by range
+    m.erase(m.begin());
+    s.erase(s.begin());
+    m.erase(m.lower_bound(200), m.lower_bound(400));
+    s.erase(s.lower_bound(200), s.lower_bound(400));
+    expect(same_content(m, s));
+
+    FlatMap h;
+    h.swap(m);
+    expect(same_content(h, s));
+    expect(m.empty());
+    h.clear();
+    expect(h.empty());
+    log("insert() erase() operator[] swap() clear()");
+}
+
+/****** Operations test *******************************************************/
+
+template <typename FlatMap>
+void operations_test()
+{
+    typedef typename FlatMap::value_type value_type;
+
+    FlatMap m;
+    std::map<int,int> s;
+    bool ok = true;
+
+    for (int i = 0; i < 3000; i += 3)
+    {
+        m.insert(m.end(), value_type(i, i));
+        s.insert(std::make_pair(i, i));
+    }
+    FlatMap const & cm = m;
+    for (int key = -5; key < 3010; key++)
+    {
+        typename FlatMap::const_iterator lb = cm.lower_bound(key);
+        typename FlatMap::const_iterator ub = cm.upper_bound(key);
+        std::map<int,int>::iterator slb = s.lower_bound(key);
+        std::map<int,int>::iterator sub = s.upper_bound(key);
+
+        ok = ok && (lb == cm.end()) == (slb == s.end());
+        ok = ok && (lb == cm.end() || lb->first == slb->first);
+        ok = ok && (ub == cm.end()) == (sub == s.end());
+        ok = ok && (ub == cm.end() || ub->first == sub->first);
+        ok = ok && cm.count(key) == s.count(key);
+        ok = ok && (m.find(key) == m.end()) == (s.find(key) == s.end());
+        ok = ok && m.equal_range(key).first == m.lower_bound(key);
+        ok = ok && m.equal_range(key).second == m.upper_bound(key);
+    }
+    expect(ok);
+    log("find() count() lower_bound() upper_bound() equal_range()");
+}
+
+/****** Flat map test *********************************************************/
+
+template <typename T>
+void flat_map_test()
+{
+    constructors_test< ft::flat_map<int,T> >();
+    modifiers_test< ft::flat_map<int,T> >();
+    operations_test< ft::flat_map<int,T> >();
+}
+
+/****** All tests *************************************************************/
+
+int main()
+{
+    flat_map_test<int>();
+    return 0;
+}
@@ -0,0 +1,196 @@
+#include <map>
+#include <vector>
+#include <iterator> // std::back_inserter
+
+#include "utils.hpp"
+#include "ft_interval_map.hpp"
+
+///@note std has no interval map: expected results come from a linear scan of
+///      a std::map holding the same intervals.
+
+typedef std::map<std::pair<int,int>,int> std_intervals;
+
+/// @return Intervals of `s` overlapping [lo, hi], in order
+std::vector<std::pair<int,int> > scan(std_intervals const & s, int lo, int hi)
+{
+    std::vector<std::pair<int,int> > v;
+
+    for (std_intervals::const_iterator it = s.begin(); it != s.end(); it++)
+        if (it->first.first <= hi && lo <= it->first.second)
+            v.push_back(it->first);
+    return v;
+}
+
+template <typename Iterator>
+bool same_intervals(std::vector<Iterator> const & out,
+                    std::vector<std::pair<int,int> > const & expected)
+{
+    if (out.size() != expected.size())
+        return false;
+    for (size_t i = 0; i < out.size(); i++)
+        if (out[i]->first.first != expected[i].first
+            || out[i]->first.second != expected[i].second)
+            return false;
+    return true;
+}
+
+/// @brief Fill both containers with the same `n` pseudo random intervals
+template <typename IntervalMap>
+void fill(IntervalMap & m, std_intervals & s, int n)
+{
+    for (int i = 0; i < n; i++)
+    {
+        int low = (i * 7919) % 1000;
+        int high = low + (i * 104729) % 50;
+        m.insert(low, high, i);
+        s.insert(std::make_pair(std::make_pair(low, high), i));
+    }
+}
+
+/****** Constructors test *****************************************************/
+
+template <typename IntervalMap>
+void constructors_test()
+{
+    typedef typename IntervalMap::value_type value_type;
+    typedef typename IntervalMap::interval_type interval_type;
+    {
+        // by default
+        IntervalMap m;
+        expect(m.empty());
+        expect(m.size() == 0);
+        expect(m.begin() == m.end());
+    }
+    {
+        // by range, then by copy
+        std::vector<value_type> v;
+        v.push_back(value_type(interval_type(1, 5), 1));
+        v.push_back(value_type(interval_type(2, 3), 2));
+        v.push_back(value_type(interval_type(2, 8), 3));
+        v.push_back(value_type(interval_type(1, 5), 4));
+
+        IntervalMap m(v.begin(), v.end());
+        expect(m.size() == 3);
+        expect(m.begin()->second == 1);
+
+        IntervalMap c(m);
+        expect(c == m);
+        c.erase(interval_type(2, 3));
+        expect(c != m);
+    }
+    log("constructors");
+}
+
+/****** Modifiers test ********************************************************/
+
+template <typename IntervalMap>
+void modifiers_test()
+{
+    typedef typename IntervalMap::interval_type interval_type;
+
+    IntervalMap m;
+
+    expect(m.insert(10, 20, 1).second);
+    expect(m.insert(10, 15, 2).second);
+    expect(!m.insert(10, 20, 3).second);
+    expect(m.size() == 2);
+
+    // ordered by low then high endpoint
+    expect(m.begin()->first == interval_type(10, 15));
+
+    expect(m.erase(interval_type(10, 20)) == 1);
+    expect(m.erase(interval_type(10, 20)) == 0);
+    expect(m.find(interval_type(10, 15)) == m.begin());
+    expect(m.find(interval_type(10, 20)) == m.end());
+
+    m.clear();
+    expect(m.empty());
+    log("insert() erase() find()");
+}
+
+/****** Queries test **********************************************************/
+
+template <typename IntervalMap>
+void stab_test()
+{
+    typedef typename IntervalMap::iterator iterator;
+    typedef typename IntervalMap::const_iterator const_iterator;
+
+    IntervalMap m;
+    std_intervals s;
+    bool ok = true;
+
+    fill(m, s, 500);
+    for (int x = -10; x < 1060; x += 7)
+    {
+        std::vector<iterator> out;
+        m.stab(x, std::back_inserter(out));
+        ok = ok && same_intervals(out, scan(s, x, x));
+
+        std::vector<const_iterator> const_out;
+        IntervalMap const & cm = m;
+        cm.stab(x, std::back_inserter(const_out));
+        ok = ok && same_intervals(const_out, scan(s, x, x));
+    }
+    expect(ok);
+    log("stab()");
+}
+
+template <typename IntervalMap>
+void overlap_test()
+{
+    typedef typename IntervalMap::iterator iterator;
+
+    IntervalMap m;
+    std_intervals s;
+    bool ok = true;
+
+    fill(m, s, 500);
+    // erase some of them, so the augmentation goes through fixups
+    for (int i = 0; i < 500; i += 3)
+    {
+        iterator it = m.find_overlap(i, i);
+        if (it != m.end())
+        {
+            s.erase(std::make_pair(it->first.first, it->first.second));
+            m.erase(it);
+        }
+    }
+    expect(m.size() == s.size());
+    for (int lo = -10; lo < 1060; lo += 13)
+    {
+        for (int hi = lo; hi < lo + 100; hi += 31)
+        {
+            std::vector<iterator> out;
+            m.overlap(lo, hi, std::back_inserter(out));
+            std::vector<std::pair<int,int> > expected = scan(s, lo, hi);
+            ok = ok && same_intervals(out, expected);
+
+            iterator it = m.find_overlap(lo, hi);
+            ok = ok && (it == m.end()) == expected.empty();
+            ok = ok && (it == m.end()
+                || (it->first.first <= hi && lo <= it->first.second));
+        }
+    }
+    expect(ok);
+    log("overlap() find_overlap()");
+}
+
+/****** Interval map test *****************************************************/
+
+template <typename T>
+void interval_map_test()
+{
+    constructors_test< ft::interval_map<int,T>>();
+    modifiers_test< ft::interval_map<int,T>>();
+    stab_test< ft::interval_map<int,T>>();
+    overlap_test< ft::interval_map<int,T>>();
+}
+
+/****** All tests *************************************************************/
+
+int main()
+{
+    interval_map_test<int>();
+    return 0;
+}
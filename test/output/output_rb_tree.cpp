@@ -292,6 +292,31 @@ void insert_test()
     log("insert");
 }
 
+template <typename Tree>
+void insert_unique_test()
+{
+    Tree t;
+    ft::pair<typename Tree::pointer, bool> p;
+
+    for (int i = 0; i < 100; i++)
+    {
+        typename Tree::key_type k = key_type<Tree>((i * 37) % 100);
+        p = t.insert_unique(k);
+        expect(p.second);
+        expect(p.first == t.find(k));
+    }
+    for (int i = 0; i < 100; i++)
+    {
+        typename Tree::key_type k = key_type<Tree>(i);
+        p = t.insert_unique(k);
+        expect(!p.second);
+        expect(p.first == t.find(k));
+    }
+    expect(t.size() == 100);
+
+    log("insert_unique");
+}
+
 /// @todo add more tests
 template <typename Tree>
 void erase_test()
@@ -313,6 +338,7 @@ void modifiers_tests()
 {
     std::cout << "== Modifiers ==" << std::endl;
     insert_test<Tree>();
+    insert_unique_test<Tree>();
     erase_test<Tree>();
 }
 
@@ -0,0 +1,259 @@
+#include <set>
+#include <map>
+#include <vector>
+
+#include "utils.hpp"
+#include "ft_set.hpp"
+#include "ft_multiset.hpp"
+#include "ft_multimap.hpp"
+
+///@note Expected results come from the std containers fed with the same
+///      operations. Equivalent keys must come out in insertion order.
+
+template <typename Container, typename Std>
+bool same_content(Container const & c, Std const & s)
+{
+    typename Container::const_iterator it = c.begin();
+    typename Std::const_iterator sit = s.begin();
+
+    if (c.size() != s.size())
+        return false;
+    for (; sit != s.end(); ++it, ++sit)
+        if (!(*it == *sit))
+            return false;
+    return true;
+}
+
+template <typename K, typename V>
+bool same_content(ft::multimap<K, V> const & c, std::multimap<K, V> const & s)
+{
+    typename ft::multimap<K, V>::const_iterator it = c.begin();
+    typename std::multimap<K, V>::const_iterator sit = s.begin();
+
+    if (c.size() != s.size())
+        return false;
+    for (; sit != s.end(); ++it, ++sit)
+        if (it->first != sit->first || it->second != sit->second)
+            return false;
+    return true;
+}
+
+/****** Set test **************************************************************/
+
+void set_test()
+{
+    ft::set<int> m;
+    std::set<int> s;
+    bool ok = true;
+
+    std::srand(42);
+    for (int i = 0; i < 5000; i++)
+    {
+        int key = std::rand() % 1000;
+        switch (std::rand() % 3)
+        {
+            case 0:
+                ok = ok && m.insert(key).second == s.insert(key).second;
+                break;
+            case 1:
+                ok = ok && m.erase(key) == s.erase(key);
+                break;
+            default:
+                ok = ok && *m.insert(m.lower_bound(key), key) == key;
+                s.insert(key);
+        }
+    }
+    expect(ok);
+    expect(same_content(m, s));
+
+    for (int key = -5; key < 1005; key++)
+    {
+        ok = ok && m.count(key) == s.count(key);
+        ok = ok && (m.lower_bound(key) == m.end()) == (s.lower_bound(key) == s.end());
+        ok = ok && (m.upper_bound(key) == m.end() || *m.upper_bound(key) == *s.upper_bound(key));
+    }
+    expect(ok);
+
+    ft::set<int> c(m);
+    expect(c == m);
+    c.erase(c.begin(), c.lower_bound(500));
+    s.erase(s.begin(), s.lower_bound(500));
+    expect(same_content(c, s));
+    expect(m < c);
+    log("set");
+}
+
+/****** Multiset test *********************************************************/
+
+void multiset_test()
+{
+    ft::multiset<int> m;
+    std::multiset<int> s;
+    bool ok = true;
+
+    std::srand(7);
+    for (int i = 0; i < 10000; i++)
+    {
+        int key = std::rand() % 300;
+        switch (std::rand() % 4)
+        {
+            case 0:
+            case 1:
+                ok = ok && *m.insert(key) == key;
+                s.insert(key);
+                break;
+            case 2:
+                ok = ok && m.erase(key) == s.erase(key);
+                break;
+            default:
+                m.insert(m.upper_bound(key), key);
+                s.insert(s.upper_bound(key), key);
+        }
+    }
+    expect(ok);
+    expect(same_content(m, s));
+
+    for (int key = -5; key < 305; key++)
+    {
+        ok = ok && m.count(key) == s.count(key);
+        size_t n = 0;
+        for (ft::multiset<int>::iterator it = m.equal_range(key).first;
+             it != m.equal_range(key).second; ++it)
+            n++;
+        ok = ok && n == s.count(key);
+        ok = ok && m.equal_range(key).first == m.lower_bound(key);
+        ok = ok && m.equal_range(key).second == m.upper_bound(key);
+    }
+    expect(ok);
+
+    // sorted range with duplicates, built in one go
+    std::vector<int> v;
+    for (int i = 0; i < 3000; i++)
+        v.push_back(i / 3);
+    ft::multiset<int> b(v.begin(), v.end());
+    std::multiset<int> sb(v.begin(), v.end());
+    expect(same_content(b, sb));
+    expect(b.count(500) == 3);
+    b.erase(b.find(10), b.find(900));
+    sb.erase(sb.find(10), sb.find(900));
+    expect(same_content(b, sb));
+    log("multiset");
+}
+
+/****** Multimap test *********************************************************/
+
+void multimap_test()
+{
+    typedef ft::multimap<int, int>::value_type value_type;
+
+    ft::multimap<int, int> m;
+    std::multimap<int, int> s;
+    bool ok = true;
+
+    std::srand(11);
+    for (int i = 0; i < 10000; i++)
+    {
+        int key = std::rand() % 200;
+        switch (std::rand() % 5)
+        {
+            case 0:
+            case 1:
+                ok = ok && m.insert(value_type(key, i))->second == i;
+                s.insert(std::make_pair(key, i));
+                break;
+            case 2:
+                ok = ok && m.erase(key) == s.erase(key);
+                break;
+            case 3:
+                // hinted: goes right before the hint when the key fits there
+                m.insert(m.lower_bound(key), value_type(key, i));
+                s.insert(s.lower_bound(key), std::make_pair(key, i));
+                break;
+            default:
+                m.insert(m.end(), value_type(key, i));
+                s.insert(s.end(), std::make_pair(key, i));
+        }
+    }
+    expect(ok);
+    expect(same_content(m, s));
+
+    for (int key = -5; key < 205; key++)
+        ok = ok && m.count(key) == s.count(key);
+    expect(ok);
+
+    // erase by position and by range
+    m.erase(m.begin());
+    s.erase(s.begin());
+    m.erase(m.lower_bound(50), m.upper_bound(150));
+    s.erase(s.lower_bound(50), s.upper_bound(150));
+    expect(same_content(m, s));
+
+    ft::multimap<int, int> c(m);
+    expect(c == m);
+    c.insert(value_type(0, 0));
+    expect(c != m);
+    c.swap(m);
+    expect(c.size() + 1 == m.size());
+    m.clear();
+    expect(m.empty());
+    log("multimap");
+}
+
+/****** Heterogeneous lookup test *********************************************/
+
+/// @brief Order of keys by their `id`, also taking plain ids
+struct by_id
+{
+    typedef void is_transparent;
+
+    bool operator() (ft::pair<int, int> const & a, ft::pair<int, int> const & b) const
+    { return a.first < b.first; }
+
+    bool operator() (ft::pair<int, int> const & a, int id) const
+    { return a.first < id; }
+
+    bool operator() (int id, ft::pair<int, int> const & b) const
+    { return id < b.first; }
+};
+
+void heterogeneous_lookup_test()
+{
+    typedef ft::pair<int, int> key;
+
+    ft::set<key, by_id> s;
+    ft::multiset<key, by_id> ms;
+    ft::multimap<key, int, by_id> mm;
+
+    for (int i = 0; i < 300; i++)
+    {
+        s.insert(key(i % 100, i));
+        ms.insert(key(i % 100, i));
+        mm.insert(ft::make_pair(key(i % 100, i), i));
+    }
+
+    bool ok = true;
+    for (int id = -1; id < 101; id++)
+    {
+        size_t n = (id >= 0 && id < 100) ? 3 : 0;
+        ok = ok && s.count(id) == n / 3 && ms.count(id) == n && mm.count(id) == n;
+        ok = ok && (n == 0 || s.find(id)->second == id);
+        ok = ok && (n == 0 || ms.find(id)->second == id);
+        ok = ok && (n == 0 || mm.find(id)->second == id);
+        ok = ok && ms.equal_range(id).first == ms.lower_bound(id);
+        ok = ok && mm.equal_range(id).second == mm.upper_bound(id);
+        ok = ok && s.upper_bound(id) == s.lower_bound(id + 1);
+    }
+    expect(ok);
+    log("heterogeneous lookup");
+}
+
+/****** All tests *************************************************************/
+
+int main()
+{
+    set_test();
+    multiset_test();
+    multimap_test();
+    heterogeneous_lookup_test();
+    return 0;
+}
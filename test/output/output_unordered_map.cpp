@@ -0,0 +1,280 @@
+#include <map>
+#include <vector>
+
+#include "utils.hpp"
+#include "ft_unordered_map.hpp"
+#include "ft_unordered_set.hpp"
+
+///@note Expected results come from a std::map fed with the same operations:
+///      contents are compared once sorted.
+
+template <typename UnorderedMap>
+bool same_content(UnorderedMap const & m, std::map<int,int> const & s)
+{
+    typename UnorderedMap::const_iterator it = m.begin();
+    std::map<int,int> sorted;
+    size_t n = 0;
+
+    for (; it != m.end(); ++it, ++n)
+        sorted[it->first] = it->second;
+    return n == m.size() && sorted == s;
+}
+
+/****** Constructors test *****************************************************/
+
+template <typename UnorderedMap>
+void constructors_test()
+{
+    typedef typename UnorderedMap::value_type value_type;
+    {
+        // by default
+        UnorderedMap m;
+        expect(m.empty());
+        expect(m.size() == 0);
+        expect(m.begin() == m.end());
+        expect(m.find(42) == m.end());
+        expect(m.bucket_count() == 0);
+    }
+    {
+        // by range, keeping the first of equal keys, then by copy
+        std::vector<value_type> v;
+        for (int i = 0; i < 1000; i++)
+            v.push_back(value_type((i * 7919) % 500, i));
+
+        UnorderedMap m(v.begin(), v.end());
+        expect(m.size() == 500);
+        expect(m.find(0)->second == 0);
+        expect(m.find(7919 % 500)->second == 1);
+
+        UnorderedMap c(m);
+        expect(c == m);
+        c.erase(250);
+        expect(c != m);
+        c = m;
+        expect(c == m);
+    }
+    log("constructors");
+}
+
+/****** Modifiers test ********************************************************/
+
+template <typename UnorderedMap>
+void modifiers_test()
+{
+    typedef typename UnorderedMap::value_type value_type;
+
+    UnorderedMap m;
+    std::map<int,int> s;
+    bool ok = true;
+
+    std::srand(42);
+    for (int i = 0; i < 20000; i++)
+    {
+        int key = std::rand() % 2000;
+        switch (std::rand() % 4)
+        {
+            case 0:
+                ok = ok && m.insert(value_type(key, i)).second
+                    == s.insert(std::make_pair(key, i)).second;
+                break;
+            case 1:
+                ok = ok && m.erase(key) == s.erase(key);
+                break;
+            case 2:
+                m[key] = i;
+                s[key] = i;
+                break;
+            default:
+                ok = ok && m.insert(m.begin(), value_type(key, i))->first == key;
+                s.insert(std::make_pair(key, i));
+        }
+    }
+    expect(ok);
+    expect(same_content(m, s));
+
+    // erase by position, then by range, which keeps other elements in place
+    typename UnorderedMap::iterator it = m.find(s.begin()->first);
+    m.erase(it);
+    s.erase(s.begin());
+    it = m.begin();
+    for (int i = 0; i < 100; i++)
+        s.erase((it++)->first);
+    m.erase(m.begin(), it);
+    expect(same_content(m, s));
+
+    UnorderedMap h;
+    h.swap(m);
+    expect(same_content(h, s));
+    expect(m.empty());
+    h.clear();
+    expect(h.empty());
+    expect(h.begin() == h.end());
+    log("insert() erase() operator[] swap() clear()");
+}
+
+/****** Hash policy test ******************************************************/
+
+template <typename UnorderedMap>
+void hash_policy_test()
+{
+    typedef typename UnorderedMap::value_type value_type;
+
+    UnorderedMap m;
+    std::map<int,int> s;
+
+    // no rehash until the reserved size is reached
+    m.reserve(1000);
+    size_t buckets = m.bucket_count();
+    expect(buckets >= 1000);
+    for (int i = 0; i < 1000; i++)
+    {
+        m.insert(value_type(i * 3, i));
+        s.insert(std::make_pair(i * 3, i));
+    }
+    expect(m.bucket_count() == buckets);
+    expect(m.load_factor() <= m.max_load_factor());
+
+    // a lower factor grows the table, which keeps every element
+    m.max_load_factor(0.25f);
+    expect(m.max_load_factor() == 0.25f);
+    expect(m.load_factor() <= 0.25f);
+    expect(m.bucket_count() > buckets);
+    expect(same_content(m, s));
+
+    // rehash may shrink the table, not under what its size needs
+    m.max_load_factor(2.0f);
+    expect(m.max_load_factor() == 1.0f);
+    m.rehash(0);
+    expect(m.bucket_count() > m.size());
+    expect(same_content(m, s));
+
+    // erasing then inserting at a constant size reuses erased slots
+    buckets = m.bucket_count();
+    for (int i = 0; i < 100000; i++)
+    {
+        m.erase(i * 3);
+        m.insert(value_type(i * 3 + 3000, i));
+    }
+    expect(m.size() == 1000);
+    expect(m.bucket_count() <= buckets * 2);
+    log("reserve() rehash() max_load_factor() load_factor()");
+}
+
+/****** Allocator test ********************************************************/
+
+/// @brief std::allocator telling its copies apart by `id`, and keeping
+///        count of the bytes they hold in `*live`
+template <typename T>
+struct counting_allocator : public std::allocator<T>
+{
+    template <typename U>
+    struct rebind { typedef counting_allocator<U> other; };
+
+    int     id;
+    long *  live;
+
+    counting_allocator (int id = 0, long * live = NULL)
+    : id(id), live(live) { }
+
+    template <typename U>
+    counting_allocator (counting_allocator<U> const & a)
+    : std::allocator<T>(), id(a.id), live(a.live) { }
+
+    T * allocate (std::size_t n)
+    {
+        if (live)
+            *live += static_cast<long>(n * sizeof(T));
+        return std::allocator<T>::allocate(n);
+    }
+
+    void deallocate (T * p, std::size_t n)
+    {
+        if (live)
+            *live -= static_cast<long>(n * sizeof(T));
+        std::allocator<T>::deallocate(p, n);
+    }
+};
+
+/// @note Control bytes and slots all come from the allocator given, and go
+///       back to it, swaps included
+template <typename UnorderedMap>
+void allocator_test()
+{
+    typedef typename UnorderedMap::allocator_type   allocator_type;
+    typedef typename UnorderedMap::value_type       value_type;
+    typedef typename UnorderedMap::hasher           hasher;
+    typedef typename UnorderedMap::key_equal        key_equal;
+
+    long live_a = 0;
+    long live_b = 0;
+    {
+        UnorderedMap a(0, hasher(), key_equal(), allocator_type(1, &live_a));
+        UnorderedMap b(0, hasher(), key_equal(), allocator_type(2, &live_b));
+        for (int i = 0; i < 1000; i++)
+            a.insert(ft::make_pair(i, i));
+        size_t capacity = a.bucket_count();
+        expect(live_a == static_cast<long>(capacity * (sizeof(value_type) + 1) + 1));
+        expect(live_b == 0);
+
+        a.swap(b);
+        expect(a.get_allocator().id == 2 && b.get_allocator().id == 1);
+        for (int i = 0; i < 100; i++)
+            a.insert(ft::make_pair(i, i));
+        b.clear();
+        b.rehash(0);
+        expect(a.size() == 100 && live_b > 0);
+    }
+    expect(live_a == 0 && live_b == 0);
+    log("get_allocator()");
+}
+
+/****** Unordered set test ****************************************************/
+
+void unordered_set_test()
+{
+    ft::unordered_set<int> set;
+    std::map<int,int> s;
+    bool ok = true;
+
+    std::srand(7);
+    for (int i = 0; i < 10000; i++)
+    {
+        int key = std::rand() % 1000;
+        if (std::rand() % 3)
+            ok = ok && set.insert(key).second == s.insert(std::make_pair(key, 0)).second;
+        else
+            ok = ok && set.erase(key) == s.erase(key);
+    }
+    expect(ok);
+    expect(set.size() == s.size());
+    for (int key = 0; key < 1000; key++)
+        ok = ok && set.count(key) == s.count(key);
+    expect(ok);
+
+    ft::unordered_set<int> copy(set);
+    expect(copy == set);
+    copy.erase(copy.begin());
+    expect(copy != set);
+    log("unordered_set");
+}
+
+/****** Unordered map test ****************************************************/
+
+template <typename T>
+void unordered_map_test()
+{
+    constructors_test< ft::unordered_map<int,T> >();
+    modifiers_test< ft::unordered_map<int,T> >();
+    hash_policy_test< ft::unordered_map<int,T> >();
+    allocator_test< ft::unordered_map<int,T,ft::hash<int>,std::equal_to<int>,
+                    counting_allocator<ft::pair<const int,T> > > >();
+}
+
+/****** All tests *************************************************************/
+
+int main()
+{
+    unordered_map_test<int>();
+    unordered_set_test();
+    return 0;
+}
@@ -700,6 +700,25 @@ void erase_test()
         for (std::vector<int>::size_type i = 0; i < b.size(); i++)
         { expect(a.at(i) == b.at(i)); }
     }
+    {
+        // erase from the middle, with distinct values so that every element
+        // after the erased range must be shifted
+        Vector a;
+        std::vector<int> b;
+        for (int i = 0; i < 21; i++)
+        {
+            a.push_back(i);
+            b.push_back(i);
+        }
+
+        expect(a.erase(a.begin() + 3) - a.begin()
+            == b.erase(b.begin() + 3) - b.begin());
+        expect(a.erase(a.begin() + 5, a.begin() + 7) - a.begin()
+            == b.erase(b.begin() + 5, b.begin() + 7) - b.begin());
+        expect(a.size() == b.size());
+        for (std::vector<int>::size_type i = 0; i < b.size(); i++)
+        { expect(a.at(i) == b.at(i)); }
+    }
     log("erase()");
 }
 
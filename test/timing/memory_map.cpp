@@ -0,0 +1,144 @@
+#include <map>
+#include <set>
+#include <new>
+#include <cstdlib>
+#include <fstream>
+
+#include "ft_map.hpp"
+#include "ft_set.hpp"
+#include "ft_multimap.hpp"
+#include "utils.hpp"
+
+///@note Heap bytes requested per element, by the containers built with 1e6
+///      elements, against the std ones. Every allocation of this program
+///      goes through the counting operator new below. Ratios below 1 are
+///      bytes saved per node: ft nodes keep their colour in the low bit of
+///      their parent pointer, std ones in a separate padded field. With
+///      index links, 32-bit links shrink nodes further, allocated by slabs.
+
+static size_t allocated_bytes = 0;
+
+void * operator new (std::size_t n)
+{
+    void * p = std::malloc(n ? n : 1);
+
+    if (p == NULL)
+        throw std::bad_alloc();
+    allocated_bytes += n;
+    return p;
+}
+
+void operator delete (void * p) noexcept
+{ std::free(p); }
+
+void operator delete (void * p, std::size_t) noexcept
+{ std::free(p); }
+
+/****** Bytes per element *****************************************************/
+
+template <typename Container>
+double get_memory_bytes_per_element()
+{
+    // some convenient typedefs
+    typedef typename Container::value_type  Value;
+
+    // data we will operate on
+    Container c;
+
+    // starting point
+    size_t start = allocated_bytes;
+
+    // compute
+    for (int i = 0; i < 1000000; i++)
+        c.insert(c.end(), Value(i, i));
+
+    // ending point
+    size_t end = allocated_bytes;
+
+    // get delta
+    return static_cast<double>(end - start) / static_cast<double>(c.size());
+}
+
+/// @brief Same as above, for containers of keys only
+template <typename Container>
+double get_memory_bytes_per_key()
+{
+    // data we will operate on
+    Container c;
+
+    // starting point
+    size_t start = allocated_bytes;
+
+    // compute
+    for (int i = 0; i < 1000000; i++)
+        c.insert(c.end(), i);
+
+    // ending point
+    size_t end = allocated_bytes;
+
+    // get delta
+    return static_cast<double>(end - start) / static_cast<double>(c.size());
+}
+
+template <typename T, typename U>
+void memory_test_map(std::ofstream & outfile)
+{
+    double ft_bytes, std_bytes;
+
+    /****** map ***************************************************************/
+
+    ft_bytes  = get_memory_bytes_per_element< ft::map<T,U>>();
+    std_bytes = get_memory_bytes_per_element<std::map<T,U>>();
+
+    timing_log(outfile, ft_bytes, std_bytes, "map,bytes_per_element_1e6");
+
+    /****** map, index links **************************************************/
+
+    typedef ft::map<T,U,std::less<T>,std::allocator<ft::pair<const T,U> >,
+                    ft::rb_no_augment, ft::rb_index_links> index_map;
+
+    ft_bytes  = get_memory_bytes_per_element<index_map>();
+    std_bytes = get_memory_bytes_per_element<std::map<T,U>>();
+
+    timing_log(outfile, ft_bytes, std_bytes, "map,bytes_per_element_index_links_1e6");
+
+    /****** multimap **********************************************************/
+
+    ft_bytes  = get_memory_bytes_per_element< ft::multimap<T,U>>();
+    std_bytes = get_memory_bytes_per_element<std::multimap<T,U>>();
+
+    timing_log(outfile, ft_bytes, std_bytes, "multimap,bytes_per_element_1e6");
+
+    /****** set ***************************************************************/
+
+    ft_bytes  = get_memory_bytes_per_key< ft::set<T>>();
+    std_bytes = get_memory_bytes_per_key<std::set<T>>();
+
+    timing_log(outfile, ft_bytes, std_bytes, "set,bytes_per_element_1e6");
+}
+
+/****** All tests *************************************************************/
+
+int main()
+{
+    // open file
+    std::ofstream outfile ("memory_map.csv", std::ofstream::trunc);
+
+    // check for open error
+    if (outfile.rdstate())
+    {
+        std::cout << "Error: can't open memory_map.csv" << std::endl;
+        return 1;
+    }
+
+    // append csv header to outfile
+    outfile << "container,function,ft,std,ratio,status" << std::endl;
+
+    // change the templated type as you want but call this function once
+    memory_test_map<int,int>(outfile);
+
+    // close file
+    outfile.close();
+
+    return 0;
+}
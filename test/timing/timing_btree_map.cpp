@@ -0,0 +1,184 @@
+#include <map>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+#include "ft_map.hpp"
+#include "ft_btree_map.hpp"
+#include "utils.hpp"
+
+///@note Each test runs on ft::btree_map, ft::map and std::map, and logs the
+///      btree against both: the std column holds std::map, then ft::map.
+///      Sizes go from 1e5 to 1e7 keys. 1e8 keys need ~5GB per binary tree:
+///      compile with -D BTREE_TIMING_MAX_KEYS=100000000 on a large machine.
+
+#ifndef BTREE_TIMING_MAX_KEYS
+# define BTREE_TIMING_MAX_KEYS 10000000
+#endif
+
+using namespace std::chrono;
+
+/// @return `n` pseudo random keys, the same for every container
+std::vector<int> random_keys(int n)
+{
+    std::vector<int> v;
+
+    std::srand(42);
+    for (int i = 0; i < n; i++)
+        v.push_back(std::rand());
+    return v;
+}
+
+/****** Insert ****************************************************************/
+
+/// @brief `n` random inserts into an empty map
+template <typename Map>
+double get_timing_btree_map_insert(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    Map m;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], keys[i]));
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/****** Find ******************************************************************/
+
+/// @brief 1e6 finds of random present keys in a map of `n` keys
+template <typename Map>
+double get_timing_btree_map_find(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    Map m; size_t found = 0;
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], keys[i]));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (size_t i = 0; i < 1000000; i++)
+        found += m.find(keys[(i * 7919) % keys.size()]) != m.end();
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (found != 1000000)
+        std::cout << "unexpected missing keys" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/****** Scan ******************************************************************/
+
+/// @brief In order scan of a map of `n` keys
+template <typename Map>
+double get_timing_btree_map_scan(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    Map m; long long sum = 0;
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], keys[i]));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+        sum += it->second;
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (sum == 0)
+        std::cout << "unexpected empty scan" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/****** Tests *****************************************************************/
+
+/// @brief Log btree_map against std::map and ft::map for `keys`
+void timing_log_btree(std::ofstream & outfile, std::string const & name,
+                      double (*bt)(std::vector<int> const &),
+                      double (*stdm)(std::vector<int> const &),
+                      double (*ftm)(std::vector<int> const &),
+                      std::vector<int> const & keys)
+{
+    double bt_chrono = bt(keys);
+
+    timing_log(outfile, bt_chrono, stdm(keys), "btree_map," + name);
+    timing_log(outfile, bt_chrono, ftm(keys), "btree_map," + name + "_vs_ft_map");
+}
+
+template <typename T, typename U>
+void timing_test_btree_map(std::ofstream & outfile)
+{
+    for (int n = 100000; n <= BTREE_TIMING_MAX_KEYS; n *= 10)
+    {
+        std::vector<int> keys = random_keys(n);
+        std::ostringstream size;
+        size << "_1e" << (n >= 100000000 ? 8 : n >= 10000000 ? 7
+                                         : n >= 1000000 ? 6 : 5);
+
+        timing_log_btree(outfile, "insert" + size.str(),
+            get_timing_btree_map_insert< ft::btree_map<T,U> >,
+            get_timing_btree_map_insert< std::map<T,U> >,
+            get_timing_btree_map_insert< ft::map<T,U> >, keys);
+
+        timing_log_btree(outfile, "find" + size.str(),
+            get_timing_btree_map_find< ft::btree_map<T,U> >,
+            get_timing_btree_map_find< std::map<T,U> >,
+            get_timing_btree_map_find< ft::map<T,U> >, keys);
+
+        timing_log_btree(outfile, "scan" + size.str(),
+            get_timing_btree_map_scan< ft::btree_map<T,U> >,
+            get_timing_btree_map_scan< std::map<T,U> >,
+            get_timing_btree_map_scan< ft::map<T,U> >, keys);
+    }
+}
+
+int main()
+{
+    // open file
+    std::ofstream outfile ("timing_btree_map.csv", std::ofstream::trunc);
+
+    // check for open error
+    if (outfile.rdstate())
+    {
+        std::cout << "Error: can't open timing_btree_map.csv" << std::endl;
+        return 1;
+    }
+
+    // append csv header to outfile
+    outfile << "container,function,ft,std,ratio,status" << std::endl;
+
+    timing_test_btree_map<int,int>(outfile);
+
+    // close file
+    outfile.close();
+
+    return 0;
+}
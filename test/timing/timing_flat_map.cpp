@@ -0,0 +1,231 @@
+#include <map>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <new> // std::bad_alloc
+
+#include "ft_map.hpp"
+#include "ft_flat_map.hpp"
+#include "utils.hpp"
+
+///@note Each test runs on ft::flat_map, std::map and ft::map, and logs the
+///      flat map against both: the std column holds std::map, then ft::map.
+
+using namespace std::chrono;
+
+/****** Memory ****************************************************************/
+
+/// @note Live heap bytes, counted by the global operator new below: a size
+///       header before each block lets operator delete subtract it.
+static size_t live_bytes = 0;
+
+void * operator new (size_t n)
+{
+    size_t * p = static_cast<size_t *>(std::malloc(n + sizeof(size_t) * 2));
+    if (p == NULL)
+        throw std::bad_alloc();
+    live_bytes += n;
+    *p = n;
+    return p + 2;
+}
+
+void operator delete (void * p) noexcept
+{
+    if (p == NULL)
+        return;
+    size_t * header = static_cast<size_t *>(p) - 2;
+    live_bytes -= *header;
+    std::free(header);
+}
+
+/// @return `n` pseudo random keys, the same for every container
+std::vector<int> random_keys(int n)
+{
+    std::vector<int> v;
+
+    std::srand(42);
+    for (int i = 0; i < n; i++)
+        v.push_back(std::rand());
+    return v;
+}
+
+/// @brief Heap bytes per element of a map of `n` random keys
+template <typename Map>
+double get_bytes_per_element(std::vector<int> const & keys)
+{
+    typedef typename Map::value_type    Value;
+
+    std::vector<Value> v;
+    for (size_t i = 0; i < keys.size(); i++)
+        v.push_back(Value(keys[i], keys[i]));
+
+    size_t before = live_bytes;
+    Map m(v.begin(), v.end());
+    return static_cast<double>(live_bytes - before)
+         / static_cast<double>(m.size());
+}
+
+/****** Build *****************************************************************/
+
+/// @brief Build a map from `n` random elements by range insert
+template <typename Map>
+double get_timing_flat_map_build(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    std::vector<Value> v;
+    for (size_t i = 0; i < keys.size(); i++)
+        v.push_back(Value(keys[i], keys[i]));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    Map m(v.begin(), v.end());
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/****** Find ******************************************************************/
+
+/// @brief 1e6 finds of random present keys in a map of `n` keys
+template <typename Map>
+double get_timing_flat_map_find(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    std::vector<Value> v; size_t found = 0;
+    for (size_t i = 0; i < keys.size(); i++)
+        v.push_back(Value(keys[i], keys[i]));
+    Map m(v.begin(), v.end());
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (size_t i = 0; i < 1000000; i++)
+        found += m.find(keys[(i * 7919) % keys.size()]) != m.end();
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (found != 1000000)
+        std::cout << "unexpected missing keys" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/****** Scan ******************************************************************/
+
+/// @brief In order scan of a map of `n` keys
+template <typename Map>
+double get_timing_flat_map_scan(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    std::vector<Value> v; long long sum = 0;
+    for (size_t i = 0; i < keys.size(); i++)
+        v.push_back(Value(keys[i], keys[i]));
+    Map m(v.begin(), v.end());
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+        sum += it->second;
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (sum == 0)
+        std::cout << "unexpected empty scan" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/****** Tests *****************************************************************/
+
+/// @brief Log flat_map against std::map and ft::map for `keys`
+void timing_log_flat(std::ofstream & outfile, std::string const & name,
+                     double (*flat)(std::vector<int> const &),
+                     double (*stdm)(std::vector<int> const &),
+                     double (*ftm)(std::vector<int> const &),
+                     std::vector<int> const & keys)
+{
+    double flat_value = flat(keys);
+
+    timing_log(outfile, flat_value, stdm(keys), "flat_map," + name);
+    timing_log(outfile, flat_value, ftm(keys), "flat_map," + name + "_vs_ft_map");
+}
+
+template <typename T, typename U>
+void timing_test_flat_map(std::ofstream & outfile)
+{
+    std::vector<int> keys_1e5 = random_keys(100000);
+    std::vector<int> keys_1e6 = random_keys(1000000);
+
+    /****** memory (heap bytes per element, not seconds) **********************/
+
+    timing_log_flat(outfile, "bytes_per_element_1e6",
+        get_bytes_per_element< ft::flat_map<T,U> >,
+        get_bytes_per_element< std::map<T,U> >,
+        get_bytes_per_element< ft::map<T,U> >, keys_1e6);
+
+    /****** build, find, scan *************************************************/
+
+    timing_log_flat(outfile, "build_1e6",
+        get_timing_flat_map_build< ft::flat_map<T,U> >,
+        get_timing_flat_map_build< std::map<T,U> >,
+        get_timing_flat_map_build< ft::map<T,U> >, keys_1e6);
+
+    timing_log_flat(outfile, "find_1e5",
+        get_timing_flat_map_find< ft::flat_map<T,U> >,
+        get_timing_flat_map_find< std::map<T,U> >,
+        get_timing_flat_map_find< ft::map<T,U> >, keys_1e5);
+
+    timing_log_flat(outfile, "find_1e6",
+        get_timing_flat_map_find< ft::flat_map<T,U> >,
+        get_timing_flat_map_find< std::map<T,U> >,
+        get_timing_flat_map_find< ft::map<T,U> >, keys_1e6);
+
+    timing_log_flat(outfile, "scan_1e6",
+        get_timing_flat_map_scan< ft::flat_map<T,U> >,
+        get_timing_flat_map_scan< std::map<T,U> >,
+        get_timing_flat_map_scan< ft::map<T,U> >, keys_1e6);
+}
+
+int main()
+{
+    // open file
+    std::ofstream outfile ("timing_flat_map.csv", std::ofstream::trunc);
+
+    // check for open error
+    if (outfile.rdstate())
+    {
+        std::cout << "Error: can't open timing_flat_map.csv" << std::endl;
+        return 1;
+    }
+
+    // append csv header to outfile
+    outfile << "container,function,ft,std,ratio,status" << std::endl;
+
+    timing_test_flat_map<int,int>(outfile);
+
+    // close file
+    outfile.close();
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include <map>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <iterator> // std::back_inserter
+
+#include "ft_interval_map.hpp"
+#include "utils.hpp"
+
+///@note std has no interval map: the baseline is what one writes without,
+///      a scan of a map of intervals from begin(), as with ft::map.
+
+using namespace std::chrono;
+
+typedef std::map<std::pair<int,int>,int> std_intervals;
+
+/// @brief Fill `m` with 1e5 intervals of length up to 1e3 over [0, 1e7)
+template <typename IntervalMap>
+void random_intervals(IntervalMap & m)
+{
+    std::srand(42);
+    for (int i = 0; i < 100000; i++)
+    {
+        int low = std::rand() % 10000000;
+        m.insert(low, low + std::rand() % 1000, i);
+    }
+}
+
+void random_intervals(std_intervals & m)
+{
+    std::srand(42);
+    for (int i = 0; i < 100000; i++)
+    {
+        int low = std::rand() % 10000000;
+        int high = low + std::rand() % 1000;
+        m.insert(std::make_pair(std::make_pair(low, high), i));
+    }
+}
+
+template <typename IntervalMap>
+size_t overlap(IntervalMap & m, int lo, int hi)
+{
+    std::vector<typename IntervalMap::iterator> out;
+    m.overlap(lo, hi, std::back_inserter(out));
+    return out.size();
+}
+
+size_t overlap(std_intervals & m, int lo, int hi)
+{
+    std::vector<std_intervals::iterator> out;
+    for (std_intervals::iterator it = m.begin(); it != m.end(); it++)
+        if (it->first.first <= hi && lo <= it->first.second)
+            out.push_back(it);
+    return out.size();
+}
+
+/****** Queries ***************************************************************/
+
+/// @brief 1e3 stabbing queries on 1e5 intervals
+template <typename IntervalMap>
+double get_timing_interval_map_stab()
+{
+    // data we will operate on
+    IntervalMap m; random_intervals(m);
+    size_t n = 0;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (int x = 0; x < 10000000; x += 10000)
+        n += overlap(m, x, x);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (n == 0)
+        std::cout << "unexpected empty stabbing queries" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @brief 1e3 overlap queries of length 1e4 on 1e5 intervals
+template <typename IntervalMap>
+double get_timing_interval_map_overlap()
+{
+    // data we will operate on
+    IntervalMap m; random_intervals(m);
+    size_t n = 0;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (int x = 0; x < 10000000; x += 10000)
+        n += overlap(m, x, x + 10000);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (n == 0)
+        std::cout << "unexpected empty overlap queries" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+void timing_test_interval_map_queries(std::ofstream & outfile)
+{
+    double ft_chrono, std_chrono;
+
+    /****** stab (1e3 queries on 1e5 intervals) *******************************/
+
+    ft_chrono  = get_timing_interval_map_stab<ft::interval_map<int,int>>();
+    std_chrono = get_timing_interval_map_stab<std_intervals>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "interval_map,stab_1e5");
+
+    /****** overlap (1e3 queries on 1e5 intervals) ****************************/
+
+    ft_chrono  = get_timing_interval_map_overlap<ft::interval_map<int,int>>();
+    std_chrono = get_timing_interval_map_overlap<std_intervals>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "interval_map,overlap_1e5");
+}
+
+int main()
+{
+    // open file
+    std::ofstream outfile ("timing_interval_map.csv", std::ofstream::trunc);
+
+    // check for open error
+    if (outfile.rdstate())
+    {
+        std::cout << "Error: can't open timing_interval_map.csv" << std::endl;
+        return 1;
+    }
+
+    // append csv header to outfile
+    outfile << "container,function,ft,std,ratio,status" << std::endl;
+
+    timing_test_interval_map_queries(outfile);
+
+    // close file
+    outfile.close();
+
+    return 0;
+}
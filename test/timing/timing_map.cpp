@@ -1,4 +1,5 @@
 #include <map>
+#include <tuple> // std::forward_as_tuple
 #include <chrono>
 #include <fstream>
 
@@ -117,6 +118,32 @@ double get_timing_map_constructor_by_range()
     return duration<double>(end - start).count();
 }
 
+template <typename Map>
+double get_timing_map_constructor_by_sorted_range()
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+    typedef typename Map::key_type      Key;
+    typedef typename Map::mapped_type   Mapped;
+
+    // data we will operate on
+    std::vector<Value> v;
+    for (int i = 0; i < 1000000; i++)
+        v.push_back(Value(Key(i), Mapped(i)));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    Map m(v.begin(), v.end());
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
 template <typename T, typename U>
 void timing_test_map_constructors(std::ofstream & outfile)
 {
@@ -144,6 +171,19 @@ void timing_test_map_constructors(std::ofstream & outfile)
     timing_log(outfile, ft_chrono, std_chrono, "map,constructor_by_range");
 }
 
+template <typename T, typename U>
+void timing_test_map_bulk_build(std::ofstream & outfile)
+{
+    double ft_chrono, std_chrono;
+
+    /****** by sorted range (1e6 keys) ****************************************/
+
+    ft_chrono  = get_timing_map_constructor_by_sorted_range< ft::map<T,U>>();
+    std_chrono = get_timing_map_constructor_by_sorted_range<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,constructor_by_sorted_range_1e6");
+}
+
 /****** Capacity **************************************************************/
 
 template <typename Map>
@@ -462,6 +502,141 @@ double get_timing_map_equal_range()
     return duration<double>(end - start).count();
 }
 
+template <typename Map>
+double get_timing_map_lower_bound_large()
+{
+    // some convenient typedefs
+    typedef typename Map::key_type      Key;
+
+    // data we will operate on
+    Map m; random_map(m, 1000000); std::vector<Key> v;
+    for (int i = 0; i < 100000; i++)
+        v.push_back(Key(rand()));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (int i = 0; i < 100000; i++)
+        (void)m.lower_bound(v[i]);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename Map>
+double get_timing_map_upper_bound_large()
+{
+    // some convenient typedefs
+    typedef typename Map::key_type      Key;
+
+    // data we will operate on
+    Map m; random_map(m, 1000000); std::vector<Key> v;
+    for (int i = 0; i < 100000; i++)
+        v.push_back(Key(rand()));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (int i = 0; i < 100000; i++)
+        (void)m.upper_bound(v[i]);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename Map>
+double get_timing_map_equal_range_large()
+{
+    // some convenient typedefs
+    typedef typename Map::key_type      Key;
+
+    // data we will operate on
+    Map m; random_map(m, 1000000); std::vector<Key> v;
+    for (int i = 0; i < 100000; i++)
+        v.push_back(Key(rand()));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (int i = 0; i < 100000; i++)
+        (void)m.equal_range(v[i]);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @note Lookups spread over a tree too big for the caches, where the node
+///       size counts.
+template <typename Map>
+double get_timing_map_find_1e6()
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+    typedef typename Map::key_type      Key;
+    typedef typename Map::mapped_type   Mapped;
+
+    // data we will operate on
+    Map m;
+    for (int i = 0; i < 1000000; i++)
+        m.insert(m.end(), Value(Key(i), Mapped(i)));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (int i = 0; i < 1000000; i++)
+        (void)m.find(Key(static_cast<int>((i * 7919L) % 1000000)));
+
+    // finding point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @note Same lookups as above, all in one batch: the probe side of a join.
+template <typename Map>
+double get_timing_map_find_batch_1e6()
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+    typedef typename Map::key_type      Key;
+    typedef typename Map::mapped_type   Mapped;
+
+    // data we will operate on
+    Map m;
+    for (int i = 0; i < 1000000; i++)
+        m.insert(m.end(), Value(Key(i), Mapped(i)));
+    std::vector<Key> keys;
+    for (int i = 0; i < 1000000; i++)
+        keys.push_back(Key(static_cast<int>((i * 7919L) % 1000000)));
+    std::vector<typename Map::iterator> found(keys.size());
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    m.find_batch(keys.begin(), keys.end(), found.begin());
+
+    // finding point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
 template <typename T, typename U>
 void timing_test_map_operations(std::ofstream & outfile)
 {
@@ -503,6 +678,50 @@ void timing_test_map_operations(std::ofstream & outfile)
     timing_log(outfile, ft_chrono, std_chrono, "map,equal_range");
 }
 
+template <typename T, typename U>
+void timing_test_map_bounds(std::ofstream & outfile)
+{
+    double ft_chrono, std_chrono;
+
+    /****** lower_bound (1e6 keys) ********************************************/
+
+    ft_chrono  = get_timing_map_lower_bound_large< ft::map<T,U>>();
+    std_chrono = get_timing_map_lower_bound_large<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,lower_bound_1e6");
+
+    /****** upper_bound (1e6 keys) ********************************************/
+
+    ft_chrono  = get_timing_map_upper_bound_large< ft::map<T,U>>();
+    std_chrono = get_timing_map_upper_bound_large<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,upper_bound_1e6");
+
+    /****** equal_range (1e6 keys) ********************************************/
+
+    ft_chrono  = get_timing_map_equal_range_large< ft::map<T,U>>();
+    std_chrono = get_timing_map_equal_range_large<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,equal_range_1e6");
+
+    /****** find (1e6 lookups in 1e6 keys, index links) ***********************/
+
+    typedef ft::map<T,U,std::less<T>,std::allocator<ft::pair<const T,U> >,
+                    ft::rb_no_augment, ft::rb_index_links> index_map;
+
+    ft_chrono  = get_timing_map_find_1e6<index_map>();
+    std_chrono = get_timing_map_find_1e6<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,find_index_links_1e6");
+
+    /****** find_batch (1e6 lookups in 1e6 keys) ******************************/
+
+    ft_chrono  = get_timing_map_find_batch_1e6< ft::map<T,U>>();
+    std_chrono = get_timing_map_find_1e6<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,find_batch_1e6");
+}
+
 /****** Modifiers *************************************************************/
 
 template <typename Map>
@@ -594,6 +813,81 @@ double get_timing_map_insert()
     return duration<double>(end - start).count();
 }
 
+template <typename Map>
+double get_timing_map_insert_ascending()
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+    typedef typename Map::key_type      Key;
+    typedef typename Map::mapped_type   Mapped;
+
+    // data we will operate on
+    Map m;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (int i = 0; i < 1000000; i++)
+        m.insert(Value(Key(i), Mapped(i)));
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename Map>
+double get_timing_map_insert_ascending_hint_end()
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+    typedef typename Map::key_type      Key;
+    typedef typename Map::mapped_type   Mapped;
+
+    // data we will operate on
+    Map m;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (int i = 0; i < 1000000; i++)
+        m.insert(m.end(), Value(Key(i), Mapped(i)));
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename Map>
+double get_timing_map_insert_ascending_hint_previous()
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+    typedef typename Map::key_type      Key;
+    typedef typename Map::mapped_type   Mapped;
+
+    // data we will operate on
+    Map m; typename Map::iterator it = m.end();
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (int i = 0; i < 1000000; i++)
+        it = m.insert(it, Value(Key(i), Mapped(i)));
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
 template <typename Map>
 double get_timing_map_swap()
 {
@@ -619,31 +913,330 @@ double get_timing_map_swap()
     return duration<double>(end - start).count();
 }
 
-template <typename T, typename U>
-void timing_test_map_modifiers(std::ofstream & outfile)
+template <typename Map>
+double get_timing_map_clear_large()
 {
-    double ft_chrono, std_chrono;
+    // data we will operate on
+    Map m; random_map(m, 1000000);
 
-    /****** clear *************************************************************/
+    // starting point
+    time_point<system_clock> start = system_clock::now();
 
-    ft_chrono  = get_timing_map_clear< ft::map<T,U>>();
-    std_chrono = get_timing_map_clear<std::map<T,U>>();
+    // compute
+    m.clear();
 
-    timing_log(outfile, ft_chrono, std_chrono, "map,clear");
+    // ending point
+    time_point<system_clock> end = system_clock::now();
 
-    /****** erase *************************************************************/
+    // get delta
+    return duration<double>(end - start).count();
+}
 
-    ft_chrono  = get_timing_map_erase< ft::map<T,U>>();
-    std_chrono = get_timing_map_erase<std::map<T,U>>();
+template <typename Map>
+double get_timing_map_erase_range_large()
+{
+    // data we will operate on
+    Map m; random_map(m, 1000000);
+    typename Map::iterator first = m.begin();
+    typename Map::iterator last = m.end();
+    for (size_t i = 0; i < m.size() / 4; i++)
+    {
+        first++;
+        last--;
+    }
 
-    timing_log(outfile, ft_chrono, std_chrono, "map,erase");
+    // starting point
+    time_point<system_clock> start = system_clock::now();
 
-    /****** insert ************************************************************/
+    // compute
+    m.erase(first, last);
 
-    ft_chrono  = get_timing_map_insert< ft::map<T,U>>();
-    std_chrono = get_timing_map_insert<std::map<T,U>>();
+    // ending point
+    time_point<system_clock> end = system_clock::now();
 
-    timing_log(outfile, ft_chrono, std_chrono, "map,insert");
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @note Queue-like drain, smallest key first: `begin()` on each round.
+template <typename Map>
+double get_timing_map_drain_begin_large()
+{
+    // data we will operate on
+    Map m; random_map(m, 1000000);
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    while (!m.empty())
+        m.erase(m.begin());
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @note Steady state around 1e5 keys, one insert then one erase of random
+///       keys each round: node allocation and release dominate.
+template <typename Map>
+double get_timing_map_churn()
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+    typedef typename Map::key_type      Key;
+    typedef typename Map::mapped_type   Mapped;
+
+    // data we will operate on
+    Map m;
+    std::vector<int> keys;
+    for (int i = 0; i < 2000000; i++)
+        keys.push_back(rand() % 200000);
+    for (int i = 0; i < 200000; i += 2)
+        m.insert(Value(Key(i), Mapped(i)));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (size_t i = 0; i < keys.size(); i += 2)
+    {
+        m.insert(Value(Key(keys[i]), Mapped(keys[i])));
+        m.erase(Key(keys[i + 1]));
+    }
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @note Build, read once, drop: the whole life of a scratch index. The
+///       destruction is timed along with the inserts.
+template <typename Map>
+double get_timing_map_build_drop()
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+    typedef typename Map::key_type      Key;
+    typedef typename Map::mapped_type   Mapped;
+
+    // data we will operate on
+    std::vector<int> keys;
+    for (int i = 0; i < 1000000; i++)
+        keys.push_back(rand());
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    {
+        Map m;
+        for (size_t i = 0; i < keys.size(); i++)
+            m.insert(Value(Key(keys[i]), Mapped(keys[i])));
+        for (size_t i = 0; i < keys.size(); i += 16)
+            m.find(Key(keys[i]));
+    }
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @note std::map has no set algebra: the baseline is what one writes
+///       without, one insert or erase per element of the small map.
+template <typename T, typename U>
+void merge_union(std::map<T,U> & m, std::map<T,U> const & other)
+{ m.insert(other.begin(), other.end()); }
+
+template <typename T, typename U>
+void merge_union(ft::map<T,U> & m, ft::map<T,U> const & other)
+{ m.merge_union(other); }
+
+template <typename T, typename U>
+void intersection(std::map<T,U> & m, std::map<T,U> const & other)
+{
+    std::map<T,U> tmp;
+    for (typename std::map<T,U>::const_iterator it = other.begin();
+         it != other.end(); it++)
+    {
+        typename std::map<T,U>::iterator found = m.find(it->first);
+        if (found != m.end())
+            tmp.insert(tmp.end(), *found);
+    }
+    m.swap(tmp);
+}
+
+template <typename T, typename U>
+void intersection(ft::map<T,U> & m, ft::map<T,U> const & other)
+{ m.intersection(other); }
+
+template <typename T, typename U>
+void difference(std::map<T,U> & m, std::map<T,U> const & other)
+{
+    for (typename std::map<T,U>::const_iterator it = other.begin();
+         it != other.end(); it++)
+        m.erase(it->first);
+}
+
+template <typename T, typename U>
+void difference(ft::map<T,U> & m, ft::map<T,U> const & other)
+{ m.difference(other); }
+
+/// @brief Reconcile a 1e6 keys map with a 2e5 keys one
+/// @param op 0 for union, 1 for intersection, 2 for difference
+template <typename Map>
+double get_timing_map_set_algebra(int op)
+{
+    // data we will operate on
+    typedef typename Map::value_type Value;
+    Map m; random_map(m, 1000000);
+    Map other;
+    // half the keys of `other` are in `m`
+    typename Map::iterator it = m.begin();
+    for (int i = 0; i < 100000; i++, it++)
+    {
+        other.insert(*it);
+        other.insert(Value(std::rand(), 0));
+    }
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    if (op == 0)
+        merge_union(m, other);
+    else if (op == 1)
+        intersection(m, other);
+    else
+        difference(m, other);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @note std::map has no order statistics: the baseline walks iterators.
+template <typename T, typename U>
+typename std::map<T,U>::iterator nth(std::map<T,U> & m, size_t k)
+{
+    typename std::map<T,U>::iterator it = m.begin();
+    std::advance(it, k);
+    return it;
+}
+
+template <typename T, typename U, typename C, typename A, typename Aug>
+typename ft::map<T,U,C,A,Aug>::iterator nth(ft::map<T,U,C,A,Aug> & m, size_t k)
+{ return m.nth(k); }
+
+template <typename T, typename U>
+size_t rank(std::map<T,U> & m, T const & key)
+{ return static_cast<size_t>(std::distance(m.begin(), m.lower_bound(key))); }
+
+template <typename T, typename U, typename C, typename A, typename Aug>
+size_t rank(ft::map<T,U,C,A,Aug> & m, T const & key)
+{ return m.rank(key); }
+
+/// @brief 1e3 nth then rank queries on a 1e5 keys map
+template <typename Map>
+double get_timing_map_order_statistics()
+{
+    // data we will operate on
+    Map m; random_map(m, 100000);
+    size_t sum = 0;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (size_t i = 0; i < 1000; i++)
+        sum += rank(m, nth(m, (i * 7919) % m.size())->first);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (sum == 0)
+        std::cout << "unexpected rank sum" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @note std::map has no range aggregate: the baseline scans the range.
+template <typename T, typename U>
+long aggregate(std::map<T,U> & m, T const & lo, T const & hi)
+{
+    long sum = 0;
+    typename std::map<T,U>::iterator last = m.lower_bound(hi);
+    for (typename std::map<T,U>::iterator it = m.lower_bound(lo); it != last;
+         it++)
+        sum += it->second;
+    return sum;
+}
+
+template <typename T, typename U, typename C, typename A, typename Aug>
+long aggregate(ft::map<T,U,C,A,Aug> & m, T const & lo, T const & hi)
+{ return m.aggregate(lo, hi); }
+
+/// @brief 1e3 sums over a tenth of a 1e5 keys map
+template <typename Map>
+double get_timing_map_aggregate()
+{
+    typedef typename Map::key_type Key;
+
+    // data we will operate on
+    Map m; random_map(m, 100000);
+    long sum = 0;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (Key lo = 0; lo < RAND_MAX - RAND_MAX / 10; lo += RAND_MAX / 1000)
+        sum += aggregate(m, lo, lo + RAND_MAX / 10);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (sum == 0)
+        std::cout << "unexpected aggregate sum" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename T, typename U>
+void timing_test_map_modifiers(std::ofstream & outfile)
+{
+    double ft_chrono, std_chrono;
+
+    /****** clear *************************************************************/
+
+    ft_chrono  = get_timing_map_clear< ft::map<T,U>>();
+    std_chrono = get_timing_map_clear<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,clear");
+
+    /****** erase *************************************************************/
+
+    ft_chrono  = get_timing_map_erase< ft::map<T,U>>();
+    std_chrono = get_timing_map_erase<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,erase");
+
+    /****** insert ************************************************************/
+
+    ft_chrono  = get_timing_map_insert< ft::map<T,U>>();
+    std_chrono = get_timing_map_insert<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,insert");
 
     /****** swap **************************************************************/
 
@@ -653,6 +1246,284 @@ void timing_test_map_modifiers(std::ofstream & outfile)
     timing_log(outfile, ft_chrono, std_chrono, "map,swap");
 }
 
+template <typename T, typename U>
+void timing_test_map_insert_hint(std::ofstream & outfile)
+{
+    double ft_chrono, std_chrono;
+
+    /****** ascending keys without hint (1e6 keys) ****************************/
+
+    ft_chrono  = get_timing_map_insert_ascending< ft::map<T,U>>();
+    std_chrono = get_timing_map_insert_ascending<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,insert_ascending_1e6");
+
+    /****** ascending keys hinted with end (1e6 keys) *************************/
+
+    ft_chrono  = get_timing_map_insert_ascending_hint_end< ft::map<T,U>>();
+    std_chrono = get_timing_map_insert_ascending_hint_end<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,insert_hint_end_1e6");
+
+    /****** ascending keys hinted with previous insert (1e6 keys) *************/
+
+    ft_chrono  = get_timing_map_insert_ascending_hint_previous< ft::map<T,U>>();
+    std_chrono = get_timing_map_insert_ascending_hint_previous<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,insert_hint_previous_1e6");
+}
+
+template <typename T, typename U>
+void timing_test_map_bulk_erase(std::ofstream & outfile)
+{
+    double ft_chrono, std_chrono;
+
+    /****** clear (1e6 keys) **************************************************/
+
+    ft_chrono  = get_timing_map_clear_large< ft::map<T,U>>();
+    std_chrono = get_timing_map_clear_large<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,clear_1e6");
+
+    /****** erase middle half by range (1e6 keys) *****************************/
+
+    ft_chrono  = get_timing_map_erase_range_large< ft::map<T,U>>();
+    std_chrono = get_timing_map_erase_range_large<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,erase_range_1e6");
+
+    /****** drain through begin() (1e6 keys) **********************************/
+
+    ft_chrono  = get_timing_map_drain_begin_large< ft::map<T,U>>();
+    std_chrono = get_timing_map_drain_begin_large<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,drain_begin_1e6");
+
+    /****** insert/erase churn (1e6 rounds around 1e5 keys) *******************/
+
+    typedef ft::map<T,U,std::less<T>,std::allocator<ft::pair<const T,U> >,
+                    ft::rb_no_augment, ft::rb_pointer_links,
+                    ft::rb_slab_storage> slab_map;
+
+    ft_chrono  = get_timing_map_churn< ft::map<T,U>>();
+    std_chrono = get_timing_map_churn<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,churn_1e6");
+
+    ft_chrono  = get_timing_map_churn<slab_map>();
+    std_chrono = get_timing_map_churn<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,churn_slab_storage_1e6");
+
+    /****** build then drop (1e6 keys) ****************************************/
+
+    typedef ft::map<T,U,std::less<T>,std::allocator<ft::pair<const T,U> >,
+                    ft::rb_no_augment, ft::rb_pointer_links,
+                    ft::rb_arena_storage> arena_map;
+
+    ft_chrono  = get_timing_map_build_drop< ft::map<T,U>>();
+    std_chrono = get_timing_map_build_drop<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,build_drop_1e6");
+
+    ft_chrono  = get_timing_map_build_drop<arena_map>();
+    std_chrono = get_timing_map_build_drop<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,build_drop_arena_storage_1e6");
+}
+
+template <typename T, typename U>
+void timing_test_map_set_algebra(std::ofstream & outfile)
+{
+    double ft_chrono, std_chrono;
+
+    /****** union (1e6 with 2e5 keys) *****************************************/
+
+    ft_chrono  = get_timing_map_set_algebra< ft::map<T,U>>(0);
+    std_chrono = get_timing_map_set_algebra<std::map<T,U>>(0);
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,merge_union_1e6_2e5");
+
+    /****** intersection (1e6 with 2e5 keys) **********************************/
+
+    ft_chrono  = get_timing_map_set_algebra< ft::map<T,U>>(1);
+    std_chrono = get_timing_map_set_algebra<std::map<T,U>>(1);
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,intersection_1e6_2e5");
+
+    /****** difference (1e6 with 2e5 keys) ************************************/
+
+    ft_chrono  = get_timing_map_set_algebra< ft::map<T,U>>(2);
+    std_chrono = get_timing_map_set_algebra<std::map<T,U>>(2);
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,difference_1e6_2e5");
+}
+
+template <typename T, typename U>
+void timing_test_map_order_statistics(std::ofstream & outfile)
+{
+    typedef ft::map<T,U,std::less<T>,std::allocator<ft::pair<const T,U> >,
+                    ft::rb_order_statistics> ft_map;
+    double ft_chrono, std_chrono;
+
+    /****** nth then rank (1e3 queries on 1e5 keys) ***************************/
+
+    ft_chrono  = get_timing_map_order_statistics<ft_map>();
+    std_chrono = get_timing_map_order_statistics<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,nth_rank_1e5");
+}
+
+template <typename T, typename U>
+void timing_test_map_aggregate(std::ofstream & outfile)
+{
+    typedef ft::map<T,U,std::less<T>,std::allocator<ft::pair<const T,U> >,
+                    ft::rb_monoid<ft::rb_sum<long> > > ft_map;
+    double ft_chrono, std_chrono;
+
+    /****** range sums (1e3 queries over 1e4 of 1e5 keys) *********************/
+
+    ft_chrono  = get_timing_map_aggregate<ft_map>();
+    std_chrono = get_timing_map_aggregate<std::map<T,U>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,aggregate_1e5");
+}
+
+/// @brief Mapped type heavy to build and copy, 256 bytes
+struct large_value
+{
+    int data[64];
+
+    large_value (int v = 0)
+    { for (int i = 0; i < 64; i++) data[i] = v + i; }
+};
+
+/// @note std::map::try_emplace is C++17: std emplaces piecewise, building
+///       the node before looking its key up.
+template <typename T, typename U>
+bool try_emplace(std::map<T,U> & m, T const & key, int v)
+{
+    return m.emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                     std::forward_as_tuple(v)).second;
+}
+
+template <typename T, typename U>
+bool try_emplace(ft::map<T,U> & m, T const & key, int v)
+{ return m.try_emplace(key, v).second; }
+
+template <typename Map>
+double get_timing_map_try_emplace_large()
+{
+    // data we will operate on
+    Map m; size_t n = 0;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute, one key out of two already in
+    for (int i = 0; i < 200000; i++)
+        n += try_emplace(m, static_cast<int>(static_cast<unsigned>(i)
+                                   * 2654435761u % 100000u), i);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (n != m.size())
+        std::cout << "unexpected insertions" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename Map>
+double get_timing_map_op_brackets_large()
+{
+    // data we will operate on
+    Map m; long long sum = 0;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute, one key out of two already in
+    for (int i = 0; i < 200000; i++)
+        sum += m[static_cast<int>(static_cast<unsigned>(i)
+                                  * 2654435761u % 100000u)].data[1];
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (sum != 200000)
+        std::cout << "unexpected values" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @note std::map node handles are C++17: std copies then erases.
+template <typename T, typename U>
+void move_entry(std::map<T,U> & from, std::map<T,U> & to, T const & key)
+{
+    typename std::map<T,U>::iterator it = from.find(key);
+    to.insert(*it);
+    from.erase(it);
+}
+
+template <typename T, typename U>
+void move_entry(ft::map<T,U> & from, ft::map<T,U> & to, T const & key)
+{ to.insert(from.extract(key)); }
+
+template <typename Map>
+double get_timing_map_move_entries_large()
+{
+    // data we will operate on
+    Map a, b;
+    for (int i = 0; i < 100000; i++)
+        a[i].data[0] = i;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute, moving every other key, scattered
+    for (int i = 0; i < 50000; i++)
+        move_entry(a, b, i * 7919 % 50000 * 2);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (a.size() != 50000 || b.size() != 50000)
+        std::cout << "unexpected sizes" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename T>
+void timing_test_map_emplace(std::ofstream & outfile)
+{
+    double ft_chrono, std_chrono;
+
+    /****** try_emplace (2e5 calls on 1e5 keys, large values) *****************/
+
+    ft_chrono  = get_timing_map_try_emplace_large< ft::map<T,large_value>>();
+    std_chrono = get_timing_map_try_emplace_large<std::map<T,large_value>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,try_emplace_large_2e5");
+
+    /****** operator[] (2e5 calls on 1e5 keys, large values) ******************/
+
+    ft_chrono  = get_timing_map_op_brackets_large< ft::map<T,large_value>>();
+    std_chrono = get_timing_map_op_brackets_large<std::map<T,large_value>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,op_brackets_large_2e5");
+
+    /****** move entries to another map (5e4 of 1e5, large values) ************/
+
+    ft_chrono  = get_timing_map_move_entries_large< ft::map<T,large_value>>();
+    std_chrono = get_timing_map_move_entries_large<std::map<T,large_value>>();
+
+    timing_log(outfile, ft_chrono, std_chrono, "map,move_entries_large_5e4");
+}
+
 /****** Operators *************************************************************/
 
 template <typename Map>
@@ -1059,10 +1930,18 @@ void timing_test_map(std::ofstream & outfile)
 {
     timing_test_map_allocator<T,U>(outfile);
 //    timing_test_map_constructors<T,U>(outfile);
+    timing_test_map_bulk_build<T,U>(outfile);
 //    timing_test_map_capacity<T,U>(outfile);
 //    timing_test_map_observers<T,U>(outfile);
 //    timing_test_map_operations<T,U>(outfile);
+    timing_test_map_bounds<T,U>(outfile);
 //    timing_test_map_modifiers<T,U>(outfile);
+    timing_test_map_insert_hint<T,U>(outfile);
+    timing_test_map_bulk_erase<T,U>(outfile);
+    timing_test_map_set_algebra<T,U>(outfile);
+    timing_test_map_order_statistics<T,U>(outfile);
+    timing_test_map_aggregate<T,U>(outfile);
+    timing_test_map_emplace<T>(outfile);
 //    timing_test_map_operators<T,U>(outfile);
 //    timing_test_map_iterators<T,U>(outfile);
 }
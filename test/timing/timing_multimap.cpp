@@ -0,0 +1,280 @@
+#include <map>
+#include <vector>
+#include <chrono>
+#include <fstream>
+
+#include "ft_map.hpp"
+#include "ft_vector.hpp"
+#include "ft_multimap.hpp"
+#include "utils.hpp"
+
+///@note Multimaps of 1e6 elements over 1e5 keys, ten values per key, timed
+///      against std::multimap. Builds and lookups are also timed against a
+///      ft::map<K, ft::vector<V> >, the way to fake a multimap before.
+
+using namespace std::chrono;
+
+/// @return Keys of the elements, ten times each key of [0, 1e5), shuffled
+std::vector<int> random_keys()
+{
+    std::vector<int> v;
+
+    for (int i = 0; i < 1000000; i++)
+        v.push_back(static_cast<int>(static_cast<unsigned>(i) * 2654435761u % 100000u));
+    return v;
+}
+
+/// @return Sum of the mapped values of an equal_range result
+template <typename Range>
+long long sum_range(Range const & range)
+{
+    long long sum = 0;
+
+    for (typename Range::first_type it = range.first; it != range.second; ++it)
+        sum += it->second;
+    return sum;
+}
+
+/****** Modifiers *************************************************************/
+
+template <typename MultiMap>
+double get_timing_multimap_insert(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename MultiMap::value_type   Value;
+
+    // data we will operate on
+    MultiMap m;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], static_cast<int>(i)));
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @brief Same as above, one vector of values per key
+template <typename Map>
+double get_timing_map_of_vectors_insert(std::vector<int> const & keys)
+{
+    // data we will operate on
+    Map m;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (size_t i = 0; i < keys.size(); i++)
+        m[keys[i]].push_back(static_cast<int>(i));
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename MultiMap>
+double get_timing_multimap_erase(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename MultiMap::value_type   Value;
+
+    // data we will operate on
+    MultiMap m;
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], static_cast<int>(i)));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute, every value of a key at once
+    for (int key = 0; key < 100000; key++)
+        m.erase(key);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename T, typename U>
+void timing_test_multimap_modifiers(std::ofstream & outfile,
+                                    std::vector<int> const & keys)
+{
+    double ft_chrono, std_chrono;
+
+    /****** insert ************************************************************/
+
+    ft_chrono  = get_timing_multimap_insert< ft::multimap<T,U>>(keys);
+    std_chrono = get_timing_multimap_insert<std::multimap<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "multimap,insert_1e6");
+
+    std_chrono = get_timing_map_of_vectors_insert<ft::map<T, ft::vector<U> > >(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "multimap,insert_1e6_vs_ft_map_of_vectors");
+
+    /****** erase *************************************************************/
+
+    ft_chrono  = get_timing_multimap_erase< ft::multimap<T,U>>(keys);
+    std_chrono = get_timing_multimap_erase<std::multimap<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "multimap,erase_1e5_keys");
+}
+
+/****** Operations ************************************************************/
+
+template <typename MultiMap>
+double get_timing_multimap_equal_range(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename MultiMap::value_type       Value;
+
+    // data we will operate on
+    MultiMap m; long long sum = 0;
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], static_cast<int>(i)));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute, visiting the values of every key
+    for (int key = 0; key < 100000; key++)
+        sum += sum_range(m.equal_range(key));
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (sum == 0)
+        std::cout << "unexpected empty ranges" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @brief Same as above, one vector of values per key
+template <typename Map>
+double get_timing_map_of_vectors_find(std::vector<int> const & keys)
+{
+    // data we will operate on
+    Map m; long long sum = 0;
+    for (size_t i = 0; i < keys.size(); i++)
+        m[keys[i]].push_back(static_cast<int>(i));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute, visiting the values of every key
+    for (int key = 0; key < 100000; key++)
+    {
+        typename Map::const_iterator it = m.find(key);
+        for (size_t i = 0; i < it->second.size(); i++)
+            sum += it->second[i];
+    }
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (sum == 0)
+        std::cout << "unexpected empty ranges" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename MultiMap>
+double get_timing_multimap_count(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename MultiMap::value_type   Value;
+
+    // data we will operate on
+    MultiMap m; size_t n = 0;
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], static_cast<int>(i)));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (int key = 0; key < 100000; key++)
+        n += m.count(key);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (n != keys.size())
+        std::cout << "unexpected count" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename T, typename U>
+void timing_test_multimap_operations(std::ofstream & outfile,
+                                     std::vector<int> const & keys)
+{
+    double ft_chrono, std_chrono;
+
+    /****** equal_range *******************************************************/
+
+    ft_chrono  = get_timing_multimap_equal_range< ft::multimap<T,U>>(keys);
+    std_chrono = get_timing_multimap_equal_range<std::multimap<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "multimap,equal_range_1e5_keys");
+
+    std_chrono = get_timing_map_of_vectors_find<ft::map<T, ft::vector<U> > >(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "multimap,equal_range_1e5_keys_vs_ft_map_of_vectors");
+
+    /****** count *************************************************************/
+
+    ft_chrono  = get_timing_multimap_count< ft::multimap<T,U>>(keys);
+    std_chrono = get_timing_multimap_count<std::multimap<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "multimap,count_1e5_keys");
+}
+
+/****** All tests *************************************************************/
+
+template <typename T, typename U>
+void timing_test_multimap(std::ofstream & outfile)
+{
+    std::vector<int> keys = random_keys();
+
+    timing_test_multimap_modifiers<T,U>(outfile, keys);
+    timing_test_multimap_operations<T,U>(outfile, keys);
+}
+
+int main()
+{
+    // open file
+    std::ofstream outfile ("timing_multimap.csv", std::ofstream::trunc);
+
+    // check for open error
+    if (outfile.rdstate())
+    {
+        std::cout << "Error: can't open timing_multimap.csv" << std::endl;
+        return 1;
+    }
+
+    // append csv header to outfile
+    outfile << "container,function,ft,std,ratio,status" << std::endl;
+
+    // change the templated type as you want but call this function once
+    timing_test_multimap<int,int>(outfile);
+
+    // close file
+    outfile.close();
+
+    return 0;
+}
@@ -0,0 +1,457 @@
+#include <unordered_map>
+#include <vector>
+#include <chrono>
+#include <fstream>
+
+#include "ft_unordered_map.hpp"
+#include "utils.hpp"
+
+///@note Timings against std::unordered_map, on 1e6 pseudo random int keys
+///      shared by both containers.
+
+using namespace std::chrono;
+
+/// @return `n` distinct pseudo random keys, the same for every container
+std::vector<int> random_keys(int n)
+{
+    std::vector<int> v;
+
+    for (int i = 0; i < n; i++)
+        v.push_back(static_cast<int>(static_cast<unsigned>(i) * 2654435761u & 0x7fffffffu));
+    return v;
+}
+
+/****** Constructors **********************************************************/
+
+template <typename Map>
+double get_timing_unordered_map_constructor_by_range(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    // we use a vecor instead of an array to not construct `Value` by default
+    std::vector<Value> v;
+    for (size_t i = 0; i < keys.size(); i++)
+        v.push_back(Value(keys[i], keys[i]));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    Map m(v.begin(), v.end());
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename T, typename U>
+void timing_test_unordered_map_constructors(std::ofstream & outfile,
+                                            std::vector<int> const & keys)
+{
+    double ft_chrono, std_chrono;
+
+    /****** constructor by range **********************************************/
+
+    ft_chrono  = get_timing_unordered_map_constructor_by_range< ft::unordered_map<T,U>>(keys);
+    std_chrono = get_timing_unordered_map_constructor_by_range<std::unordered_map<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "unordered_map,constructor_by_range_1e6");
+}
+
+/****** Operations ************************************************************/
+
+template <typename Map>
+double get_timing_unordered_map_find_hit(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    Map m; size_t found = 0;
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], keys[i]));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (size_t i = 0; i < keys.size(); i++)
+        found += m.find(keys[(i * 7919) % keys.size()]) != m.end();
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (found != keys.size())
+        std::cout << "unexpected missing keys" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename Map>
+double get_timing_unordered_map_find_miss(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    Map m; size_t found = 0;
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], keys[i]));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute, keys are all positive
+    for (size_t i = 0; i < keys.size(); i++)
+        found += m.find(-keys[i] - 1) != m.end();
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (found != 0)
+        std::cout << "unexpected found keys" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename Map>
+double get_timing_unordered_map_count(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    Map m; size_t found = 0;
+    for (size_t i = 0; i < keys.size(); i += 2)
+        m.insert(Value(keys[i], keys[i]));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute, half of them are there
+    for (size_t i = 0; i < keys.size(); i++)
+        found += m.count(keys[i]);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (found != (keys.size() + 1) / 2)
+        std::cout << "unexpected count" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename T, typename U>
+void timing_test_unordered_map_operations(std::ofstream & outfile,
+                                          std::vector<int> const & keys)
+{
+    double ft_chrono, std_chrono;
+
+    /****** find **************************************************************/
+
+    ft_chrono  = get_timing_unordered_map_find_hit< ft::unordered_map<T,U>>(keys);
+    std_chrono = get_timing_unordered_map_find_hit<std::unordered_map<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "unordered_map,find_hit_1e6");
+
+    ft_chrono  = get_timing_unordered_map_find_miss< ft::unordered_map<T,U>>(keys);
+    std_chrono = get_timing_unordered_map_find_miss<std::unordered_map<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "unordered_map,find_miss_1e6");
+
+    /****** count *************************************************************/
+
+    ft_chrono  = get_timing_unordered_map_count< ft::unordered_map<T,U>>(keys);
+    std_chrono = get_timing_unordered_map_count<std::unordered_map<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "unordered_map,count_1e6");
+}
+
+/****** Modifiers *************************************************************/
+
+template <typename Map>
+double get_timing_unordered_map_insert(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    Map m;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], keys[i]));
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename Map>
+double get_timing_unordered_map_insert_reserved(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    Map m; m.reserve(keys.size());
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], keys[i]));
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename Map>
+double get_timing_unordered_map_operator_brackets(std::vector<int> const & keys)
+{
+    // data we will operate on
+    Map m;
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute, every key twice
+    for (size_t i = 0; i < keys.size() * 2; i++)
+        m[keys[i / 2]] += 1;
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename Map>
+double get_timing_unordered_map_erase(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    Map m;
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], keys[i]));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (size_t i = 0; i < keys.size(); i++)
+        m.erase(keys[i]);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+/// @brief Insert and erase at a constant size, which leaves tombstones
+template <typename Map>
+double get_timing_unordered_map_churn(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    Map m; size_t window = keys.size() / 10;
+    for (size_t i = 0; i < window; i++)
+        m.insert(Value(keys[i], keys[i]));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (size_t i = window; i < keys.size(); i++)
+    {
+        m.erase(keys[i - window]);
+        m.insert(Value(keys[i], keys[i]));
+    }
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename T, typename U>
+void timing_test_unordered_map_modifiers(std::ofstream & outfile,
+                                         std::vector<int> const & keys)
+{
+    double ft_chrono, std_chrono;
+
+    /****** insert ************************************************************/
+
+    ft_chrono  = get_timing_unordered_map_insert< ft::unordered_map<T,U>>(keys);
+    std_chrono = get_timing_unordered_map_insert<std::unordered_map<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "unordered_map,insert_1e6");
+
+    ft_chrono  = get_timing_unordered_map_insert_reserved< ft::unordered_map<T,U>>(keys);
+    std_chrono = get_timing_unordered_map_insert_reserved<std::unordered_map<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "unordered_map,insert_reserved_1e6");
+
+    /****** operator[] ********************************************************/
+
+    ft_chrono  = get_timing_unordered_map_operator_brackets< ft::unordered_map<T,U>>(keys);
+    std_chrono = get_timing_unordered_map_operator_brackets<std::unordered_map<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "unordered_map,operator[]_2e6");
+
+    /****** erase *************************************************************/
+
+    ft_chrono  = get_timing_unordered_map_erase< ft::unordered_map<T,U>>(keys);
+    std_chrono = get_timing_unordered_map_erase<std::unordered_map<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "unordered_map,erase_1e6");
+
+    ft_chrono  = get_timing_unordered_map_churn< ft::unordered_map<T,U>>(keys);
+    std_chrono = get_timing_unordered_map_churn<std::unordered_map<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "unordered_map,churn_1e6");
+}
+
+/****** Hash policy ***********************************************************/
+
+template <typename Map>
+double get_timing_unordered_map_rehash(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    Map m;
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], keys[i]));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    m.rehash(m.bucket_count() * 2);
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename T, typename U>
+void timing_test_unordered_map_hash_policy(std::ofstream & outfile,
+                                           std::vector<int> const & keys)
+{
+    double ft_chrono, std_chrono;
+
+    /****** rehash ************************************************************/
+
+    ft_chrono  = get_timing_unordered_map_rehash< ft::unordered_map<T,U>>(keys);
+    std_chrono = get_timing_unordered_map_rehash<std::unordered_map<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "unordered_map,rehash_1e6");
+}
+
+/****** Iterators *************************************************************/
+
+template <typename Map>
+double get_timing_unordered_map_scan(std::vector<int> const & keys)
+{
+    // some convenient typedefs
+    typedef typename Map::value_type    Value;
+
+    // data we will operate on
+    Map m; long long sum = 0;
+    for (size_t i = 0; i < keys.size(); i++)
+        m.insert(Value(keys[i], keys[i]));
+
+    // starting point
+    time_point<system_clock> start = system_clock::now();
+
+    // compute
+    for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+        sum += it->second;
+
+    // ending point
+    time_point<system_clock> end = system_clock::now();
+
+    if (sum == 0)
+        std::cout << "unexpected empty scan" << std::endl;
+
+    // get delta
+    return duration<double>(end - start).count();
+}
+
+template <typename T, typename U>
+void timing_test_unordered_map_iterators(std::ofstream & outfile,
+                                         std::vector<int> const & keys)
+{
+    double ft_chrono, std_chrono;
+
+    /****** scan **************************************************************/
+
+    ft_chrono  = get_timing_unordered_map_scan< ft::unordered_map<T,U>>(keys);
+    std_chrono = get_timing_unordered_map_scan<std::unordered_map<T,U>>(keys);
+
+    timing_log(outfile, ft_chrono, std_chrono, "unordered_map,scan_1e6");
+}
+
+/****** All tests *************************************************************/
+
+template <typename T, typename U>
+void timing_test_unordered_map(std::ofstream & outfile)
+{
+    std::vector<int> keys = random_keys(1000000);
+
+    timing_test_unordered_map_constructors<T,U>(outfile, keys);
+    timing_test_unordered_map_operations<T,U>(outfile, keys);
+    timing_test_unordered_map_modifiers<T,U>(outfile, keys);
+    timing_test_unordered_map_hash_policy<T,U>(outfile, keys);
+    timing_test_unordered_map_iterators<T,U>(outfile, keys);
+}
+
+int main()
+{
+    // open file
+    std::ofstream outfile ("timing_unordered_map.csv", std::ofstream::trunc);
+
+    // check for open error
+    if (outfile.rdstate())
+    {
+        std::cout << "Error: can't open timing_unordered_map.csv" << std::endl;
+        return 1;
+    }
+
+    // append csv header to outfile
+    outfile << "container,function,ft,std,ratio,status" << std::endl;
+
+    // change the templated type as you want but call this function once
+    timing_test_unordered_map<int,int>(outfile);
+
+    // close file
+    outfile.close();
+
+    return 0;
+}